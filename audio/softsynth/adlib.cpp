@@ -1452,6 +1452,7 @@ int MidiDriver_ADLIB::open() {
 	}
 #endif
 
+	startRenderAhead();
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -1463,6 +1464,7 @@ void MidiDriver_ADLIB::close() {
 	_isOpen = false;
 
 	_mixer->stopHandle(_mixerSoundHandle);
+	stopRenderAhead();
 
 	uint i;
 	for (i = 0; i < ARRAYSIZE(_voices); ++i) {
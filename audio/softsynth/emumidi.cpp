@@ -0,0 +1,172 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/softsynth/emumidi.h"
+
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "common/timer.h"
+
+MidiDriver_Emulated *MidiDriver_Emulated::_renderAheadDriver = 0;
+
+void MidiDriver_Emulated::generateTicked(int16 *data, int len) {
+	const int stereoFactor = isStereo() ? 2 : 1;
+	int step;
+
+	while (len) {
+		step = len;
+		if (step > (_nextTick >> FIXP_SHIFT))
+			step = (_nextTick >> FIXP_SHIFT);
+
+		generateSamples(data, step);
+
+		_nextTick -= step << FIXP_SHIFT;
+		if (!(_nextTick >> FIXP_SHIFT)) {
+			if (_timerProc)
+				(*_timerProc)(_timerParam);
+
+			onTimer();
+
+			_nextTick += _samplesPerTick;
+		}
+
+		data += step * stereoFactor;
+		len -= step;
+	}
+}
+
+int MidiDriver_Emulated::readBuffer(int16 *data, const int numSamples) {
+	const int stereoFactor = isStereo() ? 2 : 1;
+	int len = numSamples / stereoFactor;
+
+	if (!_renderBuffer) {
+		generateTicked(data, len);
+		return numSamples;
+	}
+
+	int readPos, available;
+	{
+		Common::StackLock lock(_renderMutex);
+		readPos = _renderReadPos;
+		available = _renderFill;
+	}
+
+	// Only the part filled in by renderAhead() may be touched here, so the
+	// copying can happen outside of the lock.
+	const int copied = MIN(len, available);
+	for (int left = copied; left > 0;) {
+		const int chunk = MIN(left, _renderBufferSize - readPos);
+		memcpy(data, _renderBuffer + readPos * stereoFactor, chunk * stereoFactor * sizeof(int16));
+		data += chunk * stereoFactor;
+		readPos = (readPos + chunk) % _renderBufferSize;
+		left -= chunk;
+	}
+
+	{
+		Common::StackLock lock(_renderMutex);
+		_renderReadPos = readPos;
+		_renderFill -= copied;
+	}
+
+	if (copied < len) {
+		// The renderer did not keep up; play silence instead of blocking
+		// the mixer.
+		memset(data, 0, (len - copied) * stereoFactor * sizeof(int16));
+		if (!(_renderUnderruns++ & 0xFF))
+			debug(1, "MidiDriver_Emulated: render-ahead buffer underrun (%d total)", _renderUnderruns);
+	}
+
+	return numSamples;
+}
+
+void MidiDriver_Emulated::renderAheadProc(void *refCon) {
+	((MidiDriver_Emulated *)refCon)->renderAhead();
+}
+
+void MidiDriver_Emulated::renderAhead() {
+	const int stereoFactor = isStereo() ? 2 : 1;
+
+	int writePos, space;
+	{
+		Common::StackLock lock(_renderMutex);
+		writePos = (_renderReadPos + _renderFill) % _renderBufferSize;
+		space = _renderBufferSize - _renderFill;
+	}
+
+	// Only the free part is written here, readBuffer() never touches it.
+	// Render at most a quarter of the buffer per call, so that the other
+	// timer procs are not held up for long.
+	space = MIN(space, MAX(_renderBufferSize / 4, 1));
+	const int rendered = space;
+	while (space > 0) {
+		const int chunk = MIN(space, _renderBufferSize - writePos);
+		generateTicked(_renderBuffer + writePos * stereoFactor, chunk);
+		writePos = (writePos + chunk) % _renderBufferSize;
+		space -= chunk;
+	}
+
+	Common::StackLock lock(_renderMutex);
+	_renderFill += rendered;
+}
+
+void MidiDriver_Emulated::startRenderAhead() {
+	const int latency = ConfMan.getInt("midi_render_ahead");
+	if (latency <= 0 || _renderBuffer)
+		return;
+
+	if (_renderAheadDriver) {
+		warning("MidiDriver_Emulated: Another driver is already rendering ahead");
+		return;
+	}
+	_renderAheadDriver = this;
+
+	const int stereoFactor = isStereo() ? 2 : 1;
+	_renderBufferSize = getRate() * latency / 1000;
+	_renderBuffer = new int16[_renderBufferSize * stereoFactor];
+	_renderReadPos = 0;
+	_renderFill = 0;
+	_renderUnderruns = 0;
+
+	// Refill the buffer eight times per latency period. With at most a
+	// quarter of it rendered each time, it fills up twice as fast as it is
+	// played, and so catches up after a start or an underrun.
+	renderAhead();
+	g_system->getTimerManager()->installTimerProc(&renderAheadProc, latency * 1000 / 8, this, "emuMidiRenderAhead");
+	debug(1, "MidiDriver_Emulated: rendering %d ms ahead", latency);
+}
+
+void MidiDriver_Emulated::stopRenderAhead() {
+	if (!_renderBuffer)
+		return;
+
+	// Once the timer proc is removed it is guaranteed not to run anymore.
+	g_system->getTimerManager()->removeTimerProc(&renderAheadProc);
+	_renderAheadDriver = 0;
+
+	Common::StackLock lock(_renderMutex);
+	delete[] _renderBuffer;
+	_renderBuffer = 0;
+	_renderBufferSize = 0;
+	_renderFill = 0;
+}
@@ -27,6 +27,8 @@
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
 
+#include "common/mutex.h"
+
 class MidiDriver_Emulated : public Audio::AudioStream, public MidiDriver {
 protected:
 	bool _isOpen;
@@ -44,12 +46,53 @@ private:
 	int _nextTick;
 	int _samplesPerTick;
 
+	// Render-ahead mode: a ring buffer of _renderBufferSize sample frames,
+	// filled by renderAhead() and drained by readBuffer().
+	int16 *_renderBuffer;
+	int _renderBufferSize;
+	int _renderReadPos;
+	int _renderFill;
+	uint _renderUnderruns;
+	Common::Mutex _renderMutex;
+
+	// The timer manager accepts each proc only once, hence only a single
+	// driver may render ahead at a time.
+	static MidiDriver_Emulated *_renderAheadDriver;
+
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+
+	/**
+	 * Generate len sample frames, invoking the timer callback every
+	 * _samplesPerTick frames.
+	 */
+	void generateTicked(int16 *data, int len);
+
 protected:
 	int _baseFreq;
 
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
+	/**
+	 * Move the synthesis out of the mixer callback, when enabled by the
+	 * "midi_render_ahead" setting (the latency to buffer, in ms).
+	 *
+	 * The samples, along with the timer callback which feeds the synth its
+	 * MIDI events, are then generated by a timer proc running on the
+	 * backend's timer thread, and readBuffer() only copies finished
+	 * samples. Events sent from the timer callback are issued while
+	 * rendering, so they keep their exact position in the output and are
+	 * merely heard with the configured delay. Events which the engine sends
+	 * directly, however, take effect wherever the renderer happens to be,
+	 * i.e. anywhere up to the configured latency ahead of playback.
+	 *
+	 * Has to be called once the synth is ready to generate samples, and
+	 * stopRenderAhead() has to be called before it is shut down.
+	 */
+	void startRenderAhead();
+	void stopRenderAhead();
+
 public:
 	MidiDriver_Emulated(Audio::Mixer *mixer) :
 		_mixer(mixer),
@@ -58,9 +101,18 @@ public:
 		_timerParam(0),
 		_nextTick(0),
 		_samplesPerTick(0),
+		_renderBuffer(0),
+		_renderBufferSize(0),
+		_renderReadPos(0),
+		_renderFill(0),
+		_renderUnderruns(0),
 		_baseFreq(250) {
 	}
 
+	virtual ~MidiDriver_Emulated() {
+		stopRenderAhead();
+	}
+
 	// MidiDriver API
 	virtual int open() {
 		_isOpen = true;
@@ -88,34 +140,7 @@ public:
 	}
 
 	// AudioStream API
-	virtual int readBuffer(int16 *data, const int numSamples) {
-		const int stereoFactor = isStereo() ? 2 : 1;
-		int len = numSamples / stereoFactor;
-		int step;
-
-		do {
-			step = len;
-			if (step > (_nextTick >> FIXP_SHIFT))
-				step = (_nextTick >> FIXP_SHIFT);
-
-			generateSamples(data, step);
-
-			_nextTick -= step << FIXP_SHIFT;
-			if (!(_nextTick >> FIXP_SHIFT)) {
-				if (_timerProc)
-					(*_timerProc)(_timerParam);
-
-				onTimer();
-
-				_nextTick += _samplesPerTick;
-			}
-
-			data += step * stereoFactor;
-			len -= step;
-		} while (len);
-
-		return numSamples;
-	}
+	virtual int readBuffer(int16 *data, const int numSamples);
 
 	virtual bool endOfData() const {
 		return false;
@@ -172,6 +172,8 @@ static Bit16u MulTable[ 384 ];
 
 static Bit8u KslTable[ 8 * 16 ];
 static Bit8u TremoloTable[ TREMOLO_TABLE ];
+//Noise generator feedback for 8 steps at once, indexed by the low byte
+static Bit32u NoiseTable[ 256 ];
 //Start of a channel behind the chip struct start
 static Bit16u ChanOffsetTable[32];
 //Start of an operator behind the chip struct start
@@ -531,6 +533,17 @@ INLINE bool Operator::Silent() const {
 
 INLINE void Operator::Prepare( const Chip* chip )  {
 	currentLevel = totalLevel + (chip->tremoloValue & tremoloMask);
+	//A stopped or held envelope stays where it is for the whole block,
+	//so resolve the volume once instead of calling the handler per sample
+	if ( state == OFF ) {
+		blockVolumeFixed = true;
+		blockVolume = currentLevel + ENV_MAX;
+	} else if ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) ) {
+		blockVolumeFixed = true;
+		blockVolume = currentLevel + volume;
+	} else {
+		blockVolumeFixed = false;
+	}
 	waveCurrent = waveAdd;
 	if ( vibStrength >> chip->vibratoShift ) {
 		Bit32s add = vibrato >> chip->vibratoShift;
@@ -583,7 +596,7 @@ INLINE Bits Operator::GetWave( Bitu index, Bitu vol ) {
 }
 
 INLINE Bits Operator::GetSample( Bits modulation ) {
-	Bitu vol = ForwardVolume();
+	Bitu vol = blockVolumeFixed ? blockVolume : ForwardVolume();
 	if ( ENV_SILENT( vol ) ) {
 		//Simply forward the wave
 		waveIndex += waveCurrent;
@@ -615,6 +628,8 @@ Operator::Operator() {
 	totalLevel = ENV_MAX;
 	volume = ENV_MAX;
 	releaseAdd = 0;
+	blockVolume = ENV_MAX;
+	blockVolumeFixed = false;
 }
 
 /*
@@ -1030,6 +1045,10 @@ INLINE Bit32u Chip::ForwardNoise() {
 	noiseCounter += noiseAdd;
 	Bitu count = noiseCounter >> LFO_SH;
 	noiseCounter &= WAVE_MASK;
+	//The generator is linear, so 8 steps only depend on the low byte
+	for ( ; count >= 8; count -= 8 ) {
+		noiseValue = ( noiseValue >> 8 ) ^ NoiseTable[ noiseValue & 0xff ];
+	}
 	for ( ; count > 0; --count ) {
 		//Noise calculation from mame
 		noiseValue ^= ( 0x800302 ) & ( 0 - (noiseValue & 1 ) );
@@ -1463,6 +1482,15 @@ void InitTables( void ) {
 		TremoloTable[i] = val;
 		TremoloTable[TREMOLO_TABLE - 1 - i] = val;
 	}
+	//Run the noise generator 8 times for every possible low byte
+	for ( Bitu i = 0; i < 256; i++ ) {
+		Bit32u val = i;
+		for ( int step = 0; step < 8; step++ ) {
+			val ^= ( 0x800302 ) & ( 0 - (val & 1 ) );
+			val >>= 1;
+		}
+		NoiseTable[i] = val;
+	}
 	//Create a table with offsets of the channels from the start of the chip
 	DBOPL::Chip* chip = 0;
 	for ( Bitu i = 0; i < 32; i++ ) {
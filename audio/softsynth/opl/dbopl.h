@@ -129,6 +129,7 @@ public:
 	Bit32s totalLevel;			//totalLevel is added to every generated volume
 	Bit32u currentLevel;		//totalLevel + tremolo
 	Bit32s volume;				//The currently active volume
+	Bit32u blockVolume;			//currentLevel + volume while the envelope can't change within a block
 
 	Bit32u attackAdd;			//Timers for the different states of the envelope
 	Bit32u decayAdd;
@@ -147,6 +148,8 @@ public:
 	Bit8u vibStrength;
 	//Keep track of the calculated KSR so we can check for changes
 	Bit8u ksr;
+	//Set by Prepare when blockVolume can be used instead of the envelope handler
+	bool blockVolumeFixed;
 private:
 	void SetState( Bit8u s );
 	void UpdateAttack( const Chip* chip );
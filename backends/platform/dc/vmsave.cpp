@@ -317,6 +317,7 @@ class VMSaveManager : public Common::SaveFileManager {
 public:
 
   virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true) {
+	savefilesChanged();
 	OutVMSave *s = new OutVMSave(filename.c_str());
 	return compress ? Common::wrapCompressedWriteStream(s) : s;
   }
@@ -332,6 +333,7 @@ public:
   }
 
   virtual bool removeSavefile(const Common::String &filename) {
+	savefilesChanged();
 	return ::deleteSaveGame(filename.c_str());
   }
 
@@ -102,6 +102,7 @@ class PAKSaveManager : public Common::SaveFileManager {
 public:
 
 	virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true) {
+		savefilesChanged();
 		OutPAKSave *s = new OutPAKSave(filename.c_str());
 		if (!s->err()) {
 			return compress ? Common::wrapCompressedWriteStream(s) : s;
@@ -122,6 +123,7 @@ public:
 	}
 
 	virtual bool removeSavefile(const Common::String &filename) {
+		savefilesChanged();
 		return ::pakfs_deleteSaveGame(filename.c_str());
 	}
 
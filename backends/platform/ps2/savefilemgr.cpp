@@ -145,6 +145,8 @@ Common::InSaveFile *Ps2SaveFileManager::openForLoading(const Common::String &fil
 }
 
 Common::OutSaveFile *Ps2SaveFileManager::openForSaving(const Common::String &filename, bool compress) {
+	savefilesChanged();
+
 	Common::FSNode savePath(ConfMan.get("savepath")); // TODO: is this fast?
 	Common::WriteStream *sf;
 
@@ -196,6 +198,8 @@ Common::OutSaveFile *Ps2SaveFileManager::openForSaving(const Common::String &fil
 }
 
 bool Ps2SaveFileManager::removeSavefile(const Common::String &filename) {
+	savefilesChanged();
+
 	Common::FSNode savePath(ConfMan.get("savepath")); // TODO: is this fast?
 	Common::FSNode file;
 
@@ -81,6 +81,8 @@ struct TizenSaveFileManager : public DefaultSaveFileManager {
 };
 
 bool TizenSaveFileManager::removeSavefile(const Common::String &filename) {
+	savefilesChanged();
+
 	Common::String savePathName = getSavePath();
 
 	checkPath(Common::FSNode(savePathName));
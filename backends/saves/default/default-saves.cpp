@@ -31,12 +31,117 @@
 #include "common/fs.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/system.h"
+#include "common/textconsole.h"
 #include "common/zlib.h"
 
 #ifndef _WIN32_WCE
 #include <errno.h>	// for removeSavefile()
 #endif
 
+// Savefiles are written to a temporary file first, which only replaces the
+// actual savefile once it has been written completely. This needs rename()
+// to work on the paths of the file system nodes, which is the case for the
+// stdio based POSIX and Windows nodes.
+#if defined(POSIX) || defined(WIN32)
+#define DEFAULT_SAVES_USE_TEMP_FILES
+
+static const char *const kTempSuffix = ".tmp";
+
+// The old savefile is moved here while it is being replaced
+static const char *const kOldSuffix = ".old.tmp";
+
+/**
+ * Write stream for a temporary savefile. When it is finalized without any
+ * error, it replaces the actual savefile, otherwise it is removed. Thus an
+ * interrupted or failed save never destroys an existing savefile.
+ */
+class TempSaveFile : public Common::WriteStream {
+public:
+	TempSaveFile(Common::WriteStream *stream, const Common::String &tempPath, const Common::String &path)
+		: _stream(stream), _tempPath(tempPath), _path(path), _err(false), _size(0),
+		  _openTime(g_system->getMillis()) {
+	}
+
+	~TempSaveFile() {
+		finalize();
+	}
+
+	bool err() const {
+		return _err || (_stream && _stream->err());
+	}
+
+	void clearErr() {
+		if (_stream)
+			_stream->clearErr();
+	}
+
+	uint32 write(const void *dataPtr, uint32 dataSize) {
+		if (!_stream)
+			return 0;
+
+		const uint32 written = _stream->write(dataPtr, dataSize);
+		_size += written;
+		return written;
+	}
+
+	bool flush() {
+		return _stream && _stream->flush();
+	}
+
+	void finalize() {
+		if (!_stream)
+			return;
+
+		const uint32 commitTime = g_system->getMillis();
+
+		// Any error reported by the wrapped streams, including one reported
+		// before finalizing, means the old savefile has to stay.
+		// The file has to be closed before it can be renamed on Windows.
+		_err = _stream->err();
+		_stream->finalize();
+		_err |= _stream->err();
+		delete _stream;
+		_stream = 0;
+
+		if (_err) {
+			warning("Could not write savefile '%s'", _path.c_str());
+			remove(_tempPath.c_str());
+			return;
+		}
+
+		if (rename(_tempPath.c_str(), _path.c_str()) != 0) {
+			// Not all platforms allow renaming over an existing file. Move
+			// the old savefile aside then, and put it back if the new one
+			// still cannot take its place.
+			const Common::String oldPath = _path + kOldSuffix;
+			remove(oldPath.c_str());
+			if (rename(_path.c_str(), oldPath.c_str()) != 0 || rename(_tempPath.c_str(), _path.c_str()) != 0) {
+				warning("Could not rename '%s' to '%s'", _tempPath.c_str(), _path.c_str());
+				rename(oldPath.c_str(), _path.c_str());
+				remove(_tempPath.c_str());
+				_err = true;
+				return;
+			}
+			remove(oldPath.c_str());
+		}
+
+		const uint32 endTime = g_system->getMillis();
+		debug(2, "Saved %u bytes to '%s' in %u ms, %u ms of which for flushing and replacing the old savefile",
+		      _size, _path.c_str(), endTime - _openTime, endTime - commitTime);
+	}
+
+private:
+	Common::WriteStream *_stream;
+	const Common::String _tempPath, _path;
+	bool _err;
+	uint32 _size;
+	const uint32 _openTime;
+};
+
+#endif
+
 DefaultSaveFileManager::DefaultSaveFileManager() {
 }
 
@@ -70,6 +175,11 @@ Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &
 
 	if (dir.listMatchingMembers(savefiles, search) > 0) {
 		for (Common::ArchiveMemberList::const_iterator file = savefiles.begin(); file != savefiles.end(); ++file) {
+#ifdef DEFAULT_SAVES_USE_TEMP_FILES
+			// Skip the leftovers of interrupted saves
+			if ((*file)->getName().hasSuffix(kTempSuffix))
+				continue;
+#endif
 			results.push_back((*file)->getName());
 		}
 	}
@@ -98,6 +208,8 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 }
 
 Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String &filename, bool compress) {
+	savefilesChanged();
+
 	// Ensure that the savepath is valid. If not, generate an appropriate error.
 	Common::String savePathName = getSavePath();
 	checkPath(Common::FSNode(savePathName));
@@ -109,13 +221,43 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 
 	Common::FSNode file = savePath.getChild(filename);
 
+#ifdef DEFAULT_SAVES_USE_TEMP_FILES
+	Common::FSNode tempFile = savePath.getChild(filename + kTempSuffix);
+
+	// Clean up after a save which was interrupted while replacing the old
+	// savefile, or while writing the temporary file
+	Common::FSNode oldFile = savePath.getChild(filename + kOldSuffix);
+	if (oldFile.exists()) {
+		if (!file.exists())
+			rename(oldFile.getPath().c_str(), file.getPath().c_str());
+		else
+			remove(oldFile.getPath().c_str());
+	}
+	if (tempFile.exists())
+		remove(tempFile.getPath().c_str());
+
+	// Open the temporary file for saving. The compression goes inside, so
+	// that its errors also keep the temporary file from replacing the
+	// savefile.
+	Common::WriteStream *sf = tempFile.createWriteStream();
+	if (!sf)
+		return 0;
+
+	if (compress)
+		sf = Common::wrapCompressedWriteStream(sf);
+
+	return new TempSaveFile(sf, tempFile.getPath(), file.getPath());
+#else
 	// Open the file for saving
 	Common::WriteStream *sf = file.createWriteStream();
 
 	return compress ? Common::wrapCompressedWriteStream(sf) : sf;
+#endif
 }
 
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
+	savefilesChanged();
+
 	Common::String savePathName = getSavePath();
 	checkPath(Common::FSNode(savePathName));
 	if (getError().getCode() != Common::kNoError)
@@ -32,8 +32,10 @@
 #include "base/plugins.h"
 #include "base/version.h"
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/fs.h"
+#include "common/md5.h"
 #include "common/rendermode.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -85,6 +87,9 @@ static const char HELP_STRING[] =
 	"  --list-themes            Display list of all usable GUI themes\n"
 	"  -e, --music-driver=MODE  Select music driver (see README for details)\n"
 	"  --list-audio-devices     List all available audio devices\n"
+	"  --md5[=PATH]             Display the MD5 checksums of the files in PATH\n"
+	"                           (default: current directory) and the games they\n"
+	"                           are detected as\n"
 	"  -q, --language=LANG      Select language (en,de,fr,it,pt,es,jp,zh,kr,se,gb,\n"
 	"                           hb,ru,cz)\n"
 	"  -m, --music-volume=NUM   Set the music volume, 0-255 (default: 192)\n"
@@ -194,6 +199,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("native_mt32", false);
 	ConfMan.registerDefault("enable_gs", false);
 	ConfMan.registerDefault("midi_gain", 100);
+	ConfMan.registerDefault("midi_render_ahead", 0);
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
@@ -424,6 +430,10 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_COMMAND("list-audio-devices")
 			END_COMMAND
 
+			DO_LONG_OPTION_OPT("md5", ".")
+				return "md5";
+			END_OPTION
+
 			DO_LONG_OPTION_INT("output-rate")
 			END_OPTION
 
@@ -745,6 +755,45 @@ static void listAudioDevices() {
 	}
 }
 
+/** Display the checksums of the files in a game directory, and what they are detected as. */
+static void checkGameFiles(const char *path) {
+	Common::FSNode dir(path);
+	Common::FSList files;
+	if (!dir.getChildren(files, Common::FSNode::kListAll)) {
+		printf("Could not list the files in '%s'\n", path);
+		return;
+	}
+
+	Common::sort(files.begin(), files.end());
+
+	// Most detection entries only check the beginning of the files
+	const uint32 md5Bytes = 5000;
+	Common::StringMap md5s;
+	Common::computeFilesMD5(files, md5s, md5Bytes);
+
+	printf("MD5 of the first %u bytes      File\n"
+	       "-------------------------------- ------------------------------\n", md5Bytes);
+
+	for (Common::FSList::const_iterator file = files.begin(); file != files.end(); ++file) {
+		if (md5s.contains(file->getName()))
+			printf("%s %s\n", md5s[file->getName()].c_str(), file->getName().c_str());
+	}
+
+	// Unknown variants of known games are reported by the detector itself
+	GameList candidates(EngineMan.detectGames(files));
+	printf("\n");
+	if (candidates.empty())
+		printf("No games detected\n");
+
+	for (GameList::const_iterator x = candidates.begin(); x != candidates.end(); ++x) {
+		printf("Detected gameid '%s', desc '%s', language '%s', platform '%s'\n",
+			   x->gameid().c_str(),
+			   x->description().c_str(),
+			   Common::getLanguageCode(x->language()),
+			   Common::getPlatformCode(x->platform()));
+	}
+}
+
 
 #ifdef DETECTOR_TESTING_HACK
 static void runDetectorTest() {
@@ -964,6 +1013,9 @@ bool processSettings(Common::String &command, Common::StringMap &settings, Commo
 	} else if (command == "list-audio-devices") {
 		listAudioDevices();
 		return true;
+	} else if (command == "md5") {
+		checkGameFiles(settings["md5"].c_str());
+		return true;
 	} else if (command == "version") {
 		printf("%s\n", gScummVMFullVersion);
 		printf("Features compiled in: %s\n", gScummVMFeatures);
@@ -26,6 +26,8 @@
 #include "common/debug.h"
 #include "common/config-manager.h"
 
+#include "engines/metaengine.h"
+
 #ifdef DYNAMIC_MODULES
 #include "common/fs.h"
 #endif
@@ -341,6 +343,36 @@ void PluginManagerUncached::updateConfigWithFileName(const Common::String &gameI
 	}
 }
 
+/**
+ * Update the config manager with the file name of the current plugin for all
+ * the games it supports, so that any of them can later be found without
+ * loading the other plugins. The caller is responsible for flushing the
+ * config file. Returns true if anything changed.
+ **/
+bool PluginManagerUncached::updateConfigWithPluginGames() {
+	if (_currentPlugin == _allEnginePlugins.end() || !(*_currentPlugin)->getFileName())
+		return false;
+
+	if (!ConfMan.hasMiscDomain("plugin_files"))
+		ConfMan.addMiscDomain("plugin_files");
+
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("plugin_files");
+	assert(domain);
+
+	const Common::String filename = (*_currentPlugin)->getFileName();
+	const GameList games = (*(const EnginePlugin *)*_currentPlugin)->getSupportedGames();
+	bool changed = false;
+
+	for (GameList::const_iterator game = games.begin(); game != games.end(); ++game) {
+		if (!domain->contains(game->gameid()) || domain->getVal(game->gameid()) != filename) {
+			(*domain)[game->gameid()] = filename;
+			changed = true;
+		}
+	}
+
+	return changed;
+}
+
 void PluginManagerUncached::loadFirstPlugin() {
 	unloadPluginsExcept(PLUGIN_TYPE_ENGINE, NULL, false);
 
@@ -444,7 +476,7 @@ void PluginManager::addToPluginsInMemList(Plugin *plugin) {
 
 // Engine plugins
 
-#include "engines/metaengine.h"
+#include "engines/advancedDetector.h"
 
 namespace Common {
 DECLARE_SINGLETON(EngineManager);
@@ -476,17 +508,25 @@ GameDescriptor EngineManager::findGame(const Common::String &gameName, const Eng
 		}
 	}
 
-	// We failed to find it using the gameid. Scan the list of plugins
+	// We failed to find it using the gameid. Scan the list of plugins, and
+	// remember the games of each plugin we come across on the way
+	bool indexChanged = false;
 	PluginMan.loadFirstPlugin();
 	do {
+		indexChanged |= PluginMan.updateConfigWithPluginGames();
+
 		result = findGameInLoadedPlugins(gameName, plugin);
 		if (!result.gameid().empty()) {
 			// Update with new plugin file name
 			PluginMan.updateConfigWithFileName(gameName);
+			indexChanged = false;
 			break;
 		}
 	} while (PluginMan.loadNextPlugin());
 
+	if (indexChanged)
+		ConfMan.flushToDisk();
+
 	return result;
 }
 
@@ -518,8 +558,17 @@ GameList EngineManager::detectGames(const Common::FSList &fslist) const {
 	GameList candidates;
 	EnginePlugin::List plugins;
 	EnginePlugin::List::const_iterator iter;
+
+	// Let the detectors share the checksums of the files they look at
+	ADCacheScope cacheScope;
+
 	PluginManager::instance().loadFirstPlugin();
 	do {
+		// All plugins get loaded anyway, so remember which games they support.
+		// Detecting must not write the config file, the entries are saved
+		// along with the next change which does, like adding the game.
+		PluginManager::instance().updateConfigWithPluginGames();
+
 		plugins = getPlugins();
 		// Iterate over all known games and for each check if it might be
 		// the game in the presented directory.
@@ -527,6 +576,7 @@ GameList EngineManager::detectGames(const Common::FSList &fslist) const {
 			candidates.push_back((**iter)->detectGames(fslist));
 		}
 	} while (PluginManager::instance().loadNextPlugin());
+
 	return candidates;
 }
 
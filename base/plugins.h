@@ -332,6 +332,7 @@ public:
 	virtual bool loadNextPlugin() { return false; }
 	virtual bool loadPluginFromGameId(const Common::String &gameId) { return false; }
 	virtual void updateConfigWithFileName(const Common::String &gameId) {}
+	virtual bool updateConfigWithPluginGames() { return false; }
 
 	// Functions used only by the cached PluginManager
 	virtual void loadAllPlugins();
@@ -361,6 +362,7 @@ public:
 	virtual bool loadNextPlugin();
 	virtual bool loadPluginFromGameId(const Common::String &gameId);
 	virtual void updateConfigWithFileName(const Common::String &gameId);
+	virtual bool updateConfigWithPluginGames();
 
 	virtual void loadAllPlugins() {} 	// we don't allow this
 };
@@ -70,6 +70,9 @@ public:
 	/** Add a bit to the value x, making it an n+1-bit value. */
 	virtual void addBit(uint32 &x, uint32 n) = 0;
 
+	/** Are the bits handed out starting with the MSB of each data value? */
+	virtual bool isMSBFirst() const = 0;
+
 protected:
 	BitStream() {
 	}
@@ -91,8 +94,18 @@ private:
 	SeekableReadStream *_stream; ///< The input stream.
 	bool _disposeAfterUse;       ///< Should we delete the stream on destruction?
 
-	uint32 _value;   ///< Current value.
-	uint8  _inValue; ///< Position within the current value.
+	/**
+	 * Bits read from the stream, but not yet handed out.
+	 *
+	 * The next bit is kept in the MSB for MSB2LSB streams, and in the LSB
+	 * otherwise. Data values are always added as a whole, so the current
+	 * value ends after (_cacheBits % valueBits) bits.
+	 */
+	uint64 _cache;
+	uint8  _cacheBits; ///< Number of valid bits in the cache.
+
+	uint32 _readPos; ///< Stream position in bits up to which data was read into the cache.
+	uint32 _size;    ///< Size of the stream in bits, only counting whole data values.
 
 	/** Read a data value. */
 	inline uint32 readData() {
@@ -116,35 +129,75 @@ private:
 		return 0;
 	}
 
-	/** Read the next data value. */
-	inline void readValue() {
-		if ((size() - pos()) < valueBits)
-			error("BitStreamImpl::readValue(): End of bit stream reached");
+	/** Make sure the cache holds at least n bits, with n <= 32. */
+	inline void fillCache(uint8 n) {
+		if (_cacheBits >= n)
+			return;
+
+		// Only read the values needed right now, like reading bit by bit
+		// would, so that the data stream is never read further ahead
+		while ((_cacheBits < n) && ((_size - _readPos) >= valueBits)) {
+			const uint64 value = readData();
+
+			if (isMSB2LSB)
+				_cache |= value << (64 - valueBits - _cacheBits);
+			else
+				_cache |= value << _cacheBits;
+
+			_cacheBits += valueBits;
+			_readPos   += valueBits;
+		}
 
-		_value = readData();
 		if (_stream->err() || _stream->eos())
-			error("BitStreamImpl::readValue(): Read error");
+			error("BitStreamImpl::fillCache(): Read error");
+
+		if (_cacheBits < n)
+			error("BitStreamImpl::fillCache(): End of bit stream reached");
+	}
 
-		// If we're reading the bits MSB first, we need to shift the value to that position
+	/** Return the next n bits in the cache, with 0 < n <= 32. */
+	inline uint32 peekCache(uint8 n) const {
 		if (isMSB2LSB)
-			_value <<= 32 - valueBits;
-		}
+			return (uint32)(_cache >> (64 - n));
+		else
+			return (uint32)(_cache & (((uint64)1 << n) - 1));
+	}
+
+	/** Drop the next n bits from the cache, with n <= _cacheBits. */
+	inline void skipCache(uint8 n) {
+		if (n == 64)
+			_cache = 0;
+		else if (isMSB2LSB)
+			_cache <<= n;
+		else
+			_cache >>= n;
+
+		_cacheBits -= n;
+	}
+
+	void init() {
+		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
+			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
+
+		_cache     = 0;
+		_cacheBits = 0;
+		_readPos   = _stream->pos() * 8;
+		_size      = (_stream->size() & ~((uint32) ((valueBits >> 3) - 1))) * 8;
+	}
 
 public:
 	/** Create a bit stream using this input data stream and optionally delete it on destruction. */
 	BitStreamImpl(SeekableReadStream *stream, bool disposeAfterUse = false) :
-		_stream(stream), _disposeAfterUse(disposeAfterUse), _value(0), _inValue(0) {
+		_stream(stream), _disposeAfterUse(disposeAfterUse) {
 
-		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
-			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
+		init();
 	}
 
 	/** Create a bit stream using this input data stream. */
 	BitStreamImpl(SeekableReadStream &stream) :
-		_stream(&stream), _disposeAfterUse(false), _value(0), _inValue(0) {
+		_stream(&stream), _disposeAfterUse(false) {
 
-		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
-			error("BitStreamImpl: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
+		init();
 	}
 
 	~BitStreamImpl() {
@@ -154,25 +207,10 @@ public:
 
 	/** Read a bit from the bit stream. */
 	uint32 getBit() {
-		// Check if we need the next value
-		if (_inValue == 0)
-			readValue();
-
-		// Get the current bit
-		int b = 0;
-		if (isMSB2LSB)
-			b = ((_value & 0x80000000) == 0) ? 0 : 1;
-		else
-			b = ((_value & 1) == 0) ? 0 : 1;
-
-		// Shift to the next bit
-		if (isMSB2LSB)
-			_value <<= 1;
-		else
-			_value >>= 1;
+		fillCache(1);
 
-		// Increase the position within the current value
-		_inValue = (_inValue + 1) % valueBits;
+		const uint32 b = peekCache(1);
+		skipCache(1);
 
 		return b;
 	}
@@ -194,35 +232,19 @@ public:
 		if (n > 32)
 			error("BitStreamImpl::getBits(): Too many bits requested to be read");
 
-		// Read the number of bits
-		uint32 v = 0;
+		fillCache(n);
 
-		if (isMSB2LSB) {
-			while (n-- > 0)
-				v = (v << 1) | getBit();
-		} else {
-			for (uint32 i = 0; i < n; i++)
-				v = (v >> 1) | (((uint32) getBit()) << 31);
-
-			v >>= (32 - n);
-		}
+		const uint32 v = peekCache(n);
+		skipCache(n);
 
 		return v;
 	}
 
 	/** Read a bit from the bit stream, without changing the stream's position. */
 	uint32 peekBit() {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curPos  = _stream->pos();
+		fillCache(1);
 
-		uint32 v = getBit();
-
-		_stream->seek(curPos);
-		_inValue = inValue;
-		_value   = value;
-
-		return v;
+		return peekCache(1);
 	}
 
 	/**
@@ -231,17 +253,15 @@ public:
 	 * The bit order is the same as in getBits().
 	 */
 	uint32 peekBits(uint8 n) {
-		uint32 value   = _value;
-		uint8  inValue = _inValue;
-		uint32 curPos  = _stream->pos();
+		if (n == 0)
+			return 0;
 
-		uint32 v = getBits(n);
+		if (n > 32)
+			error("BitStreamImpl::peekBits(): Too many bits requested to be read");
 
-		_stream->seek(curPos);
-		_inValue = inValue;
-		_value   = value;
+		fillCache(n);
 
-		return v;
+		return peekCache(n);
 	}
 
 	/**
@@ -265,38 +285,52 @@ public:
 			x = (x & ~(1 << n)) | (getBit() << n);
 	}
 
+	bool isMSBFirst() const {
+		return isMSB2LSB;
+	}
+
 	/** Rewind the bit stream back to the start. */
 	void rewind() {
 		_stream->seek(0);
 
-		_value   = 0;
-		_inValue = 0;
+		_cache     = 0;
+		_cacheBits = 0;
+		_readPos   = 0;
 	}
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		if (n <= _cacheBits) {
+			skipCache(n);
+			return;
+		}
+
+		n -= _cacheBits;
+		skipCache(_cacheBits);
+
+		while (n > 32) {
+			fillCache(32);
+			skipCache(32);
+			n -= 32;
+		}
+
+		fillCache(n);
+		skipCache(n);
 	}
 
 	/** Skip the bits to closest data value border. */
 	void align() {
-		while (_inValue)
-			getBit();
+		skipCache(_cacheBits % valueBits);
 	}
 
 	/** Return the stream position in bits. */
 	uint32 pos() const {
-		if (_stream->pos() == 0)
-			return 0;
-
-		uint32 p = (_inValue == 0) ? _stream->pos() : ((_stream->pos() - 1) & ~((uint32) ((valueBits >> 3) - 1)));
-		return p * 8 + _inValue;
+		return _readPos - _cacheBits;
 	}
 
 	/** Return the stream size in bits. */
 	uint32 size() const {
-		return (_stream->size() & ~((uint32) ((valueBits >> 3) - 1))) * 8;
+		return _size;
 	}
 
 	bool eos() const {
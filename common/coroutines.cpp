@@ -72,6 +72,69 @@ static void displayCoroStats() {
 } // End of anonymous namespace
 #endif
 
+namespace {
+
+enum {
+	kContextGranularity = 16,  ///< Context sizes are rounded up to this
+	kContextSizeClasses = 16   ///< Contexts up to 256 bytes are pooled
+};
+
+/** An unused context in one of the free lists */
+struct FreeContext {
+	FreeContext *next;
+};
+
+/** Free lists of unused contexts, one per size class */
+static FreeContext *s_freeContexts[kContextSizeClasses];
+
+static uint32 s_contextAllocs = 0;
+static uint32 s_contextReuses = 0;
+
+} // End of anonymous namespace
+
+void *CoroBaseContext::operator new(size_t size) {
+	const uint sizeClass = (size - 1) / kContextGranularity;
+	if (sizeClass >= kContextSizeClasses) {
+		s_contextAllocs++;
+		return ::operator new(size);
+	}
+
+	FreeContext *context = s_freeContexts[sizeClass];
+	if (context) {
+		s_freeContexts[sizeClass] = context->next;
+		s_contextReuses++;
+		return context;
+	}
+
+	s_contextAllocs++;
+	return ::operator new((sizeClass + 1) * kContextGranularity);
+}
+
+void CoroBaseContext::operator delete(void *ptr, size_t size) {
+	if (!ptr)
+		return;
+
+	const uint sizeClass = (size - 1) / kContextGranularity;
+	if (sizeClass >= kContextSizeClasses) {
+		::operator delete(ptr);
+		return;
+	}
+
+	FreeContext *context = (FreeContext *)ptr;
+	context->next = s_freeContexts[sizeClass];
+	s_freeContexts[sizeClass] = context;
+}
+
+void CoroBaseContext::freePool() {
+	for (int i = 0; i < kContextSizeClasses; i++) {
+		while (s_freeContexts[i]) {
+			FreeContext *context = s_freeContexts[i];
+			s_freeContexts[i] = context->next;
+			::operator delete(context);
+		}
+	}
+}
+
 CoroBaseContext::CoroBaseContext(const char *func)
 	: _line(0), _sleep(0), _subctx(0) {
 #ifdef COROUTINE_DEBUG
@@ -99,11 +162,8 @@ CoroutineScheduler::CoroutineScheduler() {
 	pFreeProcesses = NULL;
 	pCurrent = NULL;
 
-#ifdef DEBUG
-	// diagnostic process counters
-	numProcs = 0;
-	maxProcs = 0;
-#endif
+	// diagnostic counters
+	memset(&_stats, 0, sizeof(_stats));
 
 	pRCfunction = NULL;
 	pidCounter = 0;
@@ -134,13 +194,13 @@ CoroutineScheduler::~CoroutineScheduler() {
 	Common::List<EVENT *>::iterator i;
 	for (i = _events.begin(); i != _events.end(); ++i)
 		delete *i;
+
+	CoroBaseContext::freePool();
 }
 
 void CoroutineScheduler::reset() {
-#ifdef DEBUG
 	// clear number of process in use
-	numProcs = 0;
-#endif
+	_stats.numProcs = 0;
 
 	if (processList == NULL) {
 		// first time - allocate memory for process list
@@ -180,10 +240,28 @@ void CoroutineScheduler::reset() {
 
 #ifdef DEBUG
 void CoroutineScheduler::printStats() {
-	debug("%i process of %i used", maxProcs, CORO_NUM_PROCESS);
+	debug("%i process of %i used", _stats.maxProcs, CORO_NUM_PROCESS);
 }
 #endif
 
+const CoroStats &CoroutineScheduler::getStats() {
+	_stats.contextAllocs = s_contextAllocs;
+	_stats.contextReuses = s_contextReuses;
+	return _stats;
+}
+
+String CoroutineScheduler::getStatsDescription() {
+	const CoroStats &stats = getStats();
+	String desc = String::format("%d processes in use, at most %d\n", stats.numProcs, stats.maxProcs);
+	desc += String::format("%d ticks, %d resumes, last tick: %d resumes in %d ms\n", stats.ticks, stats.resumes, stats.tickResumes, stats.tickTime);
+	desc += String::format("%d contexts allocated, %d reused\n", stats.contextAllocs, stats.contextReuses);
+
+	for (const PROCESS *proc = active->pNext; proc; proc = proc->pNext)
+		desc += String::format("  pid %08x: sleep %d, %d resumes\n", proc->pid, proc->sleepTime, proc->resumeCount);
+
+	return desc;
+}
+
 #ifdef DEBUG
 void CoroutineScheduler::checkStack() {
 	Common::List<PROCESS *> pList;
@@ -220,6 +298,10 @@ void CoroutineScheduler::checkStack() {
 #endif
 
 void CoroutineScheduler::schedule() {
+	const uint32 tickStart = g_system->getMillis();
+	_stats.ticks++;
+	_stats.tickResumes = 0;
+
 	// start dispatching active process list
 	PROCESS *pNext;
 	PROCESS *pProc = active->pNext;
@@ -231,6 +313,9 @@ void CoroutineScheduler::schedule() {
 			pCurrent = pProc;
 			pProc->coroAddr(pProc->state, pProc->param);
 
+			pProc->resumeCount++;
+			_stats.tickResumes++;
+
 			if (!pProc->state || pProc->state->_sleep <= 0) {
 				// Coroutine finished
 				pCurrent = pCurrent->pPrevious;
@@ -247,6 +332,9 @@ void CoroutineScheduler::schedule() {
 		pProc = pNext;
 	}
 
+	_stats.resumes += _stats.tickResumes;
+	_stats.tickTime = g_system->getMillis() - tickStart;
+
 	// Disable any events that were pulsed
 	Common::List<EVENT *>::iterator i;
 	for (i = _events.begin(); i != _events.end(); ++i) {
@@ -497,11 +585,9 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// trap no free process
 	assert(pProc != NULL); // Out of processes
 
-#ifdef DEBUG
 	// one more process in use
-	if (++numProcs > maxProcs)
-		maxProcs = numProcs;
-#endif
+	if (++_stats.numProcs > _stats.maxProcs)
+		_stats.maxProcs = _stats.numProcs;
 
 	// get link to next free process
 	pFreeProcesses = pProc->pNext;
@@ -540,6 +626,9 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// set new process id
 	pProc->pid = pid;
 
+	// clear diagnostic counters
+	pProc->resumeCount = 0;
+
 	// set new process specific info
 	if (sizeParam) {
 		assert(sizeParam > 0 && sizeParam <= CORO_PARAM_SIZE);
@@ -568,11 +657,9 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 	// can not kill the current process using killProcess !
 	assert(pCurrent != pKillProc);
 
-#ifdef DEBUG
 	// one less process in use
-	--numProcs;
-	assert(numProcs >= 0);
-#endif
+	--_stats.numProcs;
+	assert(_stats.numProcs >= 0);
 
 	// Free process' resources
 	if (pRCfunction != NULL)
@@ -649,11 +736,9 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 		}
 	}
 
-#ifdef DEBUG
 	// adjust process in use
-	numProcs -= numKilled;
-	assert(numProcs >= 0);
-#endif
+	_stats.numProcs -= numKilled;
+	assert(_stats.numProcs >= 0);
 
 	// return number of processes killed
 	return numKilled;
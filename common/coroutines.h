@@ -27,6 +27,7 @@
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
 #include "common/list.h"
 #include "common/singleton.h"
+#include "common/str.h"
 
 namespace Common {
 
@@ -66,6 +67,18 @@ struct CoroBaseContext {
 	 * Destructor for coroutine context
 	 */
 	virtual ~CoroBaseContext();
+
+	/**
+	 * Contexts are created and destroyed on almost every coroutine call, so
+	 * they are kept in free lists by size instead of going back to the heap.
+	 */
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr, size_t size);
+
+	/**
+	 * Releases the memory of all contexts in the free lists.
+	 */
+	static void freePool();
 };
 
 typedef CoroBaseContext *CoroContext;
@@ -309,9 +322,23 @@ struct PROCESS {
 	uint32 pid;         ///< process ID
 	uint32 pidWaiting[CORO_MAX_PID_WAITING];    ///< Process ID(s) process is currently waiting on
 	char param[CORO_PARAM_SIZE];    ///< process specific info
+
+	uint32 resumeCount; ///< number of times the process has been run
 };
 typedef PROCESS *PPROCESS;
 
+/** Scheduler statistics, as shown by the engine debuggers */
+struct CoroStats {
+	int numProcs;           ///< number of processes in use
+	int maxProcs;           ///< highest number of processes in use at once
+	uint32 ticks;           ///< number of scheduler cycles run
+	uint32 resumes;         ///< number of times any process has been run
+	uint32 tickResumes;     ///< number of processes run during the last cycle
+	uint32 tickTime;        ///< duration of the last cycle, in milliseconds
+	uint32 contextAllocs;   ///< number of coroutine contexts taken from the heap
+	uint32 contextReuses;   ///< number of coroutine contexts taken from the free lists
+};
+
 
 /** Event structure */
 struct EVENT {
@@ -362,11 +389,10 @@ private:
 	/** Event list */
 	Common::List<EVENT *> _events;
 
-#ifdef DEBUG
-	// diagnostic process counters
-	int numProcs;
-	int maxProcs;
+	/** Diagnostic counters */
+	CoroStats _stats;
 
+#ifdef DEBUG
 	/**
 	 * Checks both the active and free process list to insure all the links are valid,
 	 * and that no processes have been lost
@@ -395,6 +421,17 @@ public:
 	void printStats();
 #endif
 
+	/**
+	 * Returns the diagnostic counters of the scheduler.
+	 */
+	const CoroStats &getStats();
+
+	/**
+	 * Returns the diagnostic counters and the active processes as text,
+	 * one line per entry, for the engine debuggers.
+	 */
+	String getStatsDescription();
+
 	/**
 	 * Give all active processes a chance to run
 	 */
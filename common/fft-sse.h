@@ -0,0 +1,42 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_FFT_SSE_H
+#define COMMON_FFT_SSE_H
+
+/**
+ * Internal header of the FFT and RDFT implementations, not to be included
+ * anywhere else.
+ *
+ * The transforms are the one place which uses SSE intrinsics directly. They
+ * are the bulk of the Bink audio and QDM2 decoding, and the vector versions
+ * produce exactly the same output as the scalar code, which test/common/fft.h
+ * checks. Everything else is written as portable scalar code.
+ *
+ * Define DISABLE_FFT_SSE to always use the scalar code.
+ */
+#if !defined(DISABLE_FFT_SSE) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define FFT_USE_SSE
+#include <xmmintrin.h>
+#endif
+
+#endif
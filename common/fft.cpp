@@ -28,6 +28,7 @@
 
 #include "common/cosinetables.h"
 #include "common/fft.h"
+#include "common/fft-sse.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
@@ -53,9 +54,40 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 		else
 			_cosTables[i] = 0;
 	}
+
+	for (int i = 0; i < ARRAYSIZE(_twiddles); i++)
+		_twiddles[i] = 0;
+
+#ifdef FFT_USE_SSE
+	// The vectorized passes handle two butterflies at once. Lay the twiddle
+	// factors out in the order they are used, with each of them repeated for
+	// the real and imaginary part.
+	for (int logn = 5; logn <= _bits; logn++) {
+		const float * const cosTable = _cosTables[logn - 4]->getTable();
+		const int quarter = 1 << (logn - 2);
+
+		float *tw = _twiddles[logn - 4] = new float[quarter * 4];
+
+		for (int k = 0; k < quarter; k += 2, tw += 8) {
+			for (int j = 0; j < 2; j++) {
+				// The first butterfly of each pass is multiplied by 1
+				const float wre = (k + j) ? cosTable[k + j] : 1.0f;
+				const float wim = (k + j) ? cosTable[quarter - (k + j)] : 0.0f;
+
+				tw[j * 2 + 0] = tw[j * 2 + 1] = wre;
+				tw[j * 2 + 4] = tw[j * 2 + 5] = wim;
+			}
+		}
+	}
+#endif
 }
 
 FFT::~FFT() {
+	for (int i = 0; i < ARRAYSIZE(_cosTables); i++) {
+		delete _cosTables[i];
+		delete[] _twiddles[i];
+	}
+
 	delete[] _revTab;
 	delete[] _expTab;
 	delete[] _tmpBuf;
@@ -165,11 +197,64 @@ static void name(Complex *z, const float *wre, unsigned int n) { \
 	} while(--n);\
 }
 
+#ifndef FFT_USE_SSE
+
 PASS(pass)
 #undef BUTTERFLIES
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+#else
+
+/* z[0...8n-1], two butterflies per iteration, tw as set up in the constructor.
+ * Does the same operations in the same order as PASS, so the results match. */
+static void passSSE(Complex *z, const float *tw, unsigned int n) {
+	const unsigned int o1 = 2 * n;
+	const unsigned int o2 = 4 * n;
+	const unsigned int o3 = 6 * n;
+
+	// Sign masks for the (re, im, re, im) lanes
+	const __m128 negIm = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+	const __m128 negRe = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+	for (unsigned int i = 0; i < o1; i += 2, tw += 8) {
+		float * const p0 = &z[i].re;
+		float * const p1 = &z[i + o1].re;
+		float * const p2 = &z[i + o2].re;
+		float * const p3 = &z[i + o3].re;
+
+		const __m128 wre = _mm_loadu_ps(tw);
+		const __m128 wim = _mm_loadu_ps(tw + 4);
+
+		const __m128 a0 = _mm_loadu_ps(p0);
+		const __m128 a1 = _mm_loadu_ps(p1);
+		const __m128 a2 = _mm_loadu_ps(p2);
+		const __m128 a3 = _mm_loadu_ps(p3);
+
+		// (im, re) of a2 and a3
+		const __m128 a2s = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 a3s = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 0, 1));
+
+		// (t1, t2) and (t5, t6)
+		const __m128 t12 = _mm_add_ps(_mm_mul_ps(a2, wre), _mm_xor_ps(_mm_mul_ps(a2s, wim), negIm));
+		const __m128 t56 = _mm_add_ps(_mm_mul_ps(a3, wre), _mm_xor_ps(_mm_mul_ps(a3s, wim), negRe));
+
+		// (t5 + t1, t6 + t2) and (t3, -t4)
+		const __m128 sum  = _mm_add_ps(t56, t12);
+		const __m128 diff = _mm_sub_ps(t56, t12);
+
+		// (t4, t3)
+		const __m128 rot = _mm_xor_ps(_mm_shuffle_ps(diff, diff, _MM_SHUFFLE(2, 3, 0, 1)), negRe);
+
+		_mm_storeu_ps(p0, _mm_add_ps(a0, sum));
+		_mm_storeu_ps(p2, _mm_sub_ps(a0, sum));
+		_mm_storeu_ps(p1, _mm_add_ps(a1, rot));
+		_mm_storeu_ps(p3, _mm_sub_ps(a1, rot));
+	}
+}
+
+#endif // FFT_USE_SSE
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -234,10 +319,14 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
+#ifdef FFT_USE_SSE
+		passSSE(z, _twiddles[logn - 4], (n / 4) / 2);
+#else
 		if (n > 1024)
 			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 		else
 			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+#endif
 	}
 }
 
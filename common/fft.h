@@ -72,6 +72,9 @@ private:
 
 	CosineTable *_cosTables[13];
 
+	/** Twiddle factors laid out for the vectorized passes, per transform size. */
+	float *_twiddles[13];
+
 	void fft4(Complex *z);
 	void fft8(Complex *z);
 	void fft16(Complex *z);
@@ -29,6 +29,12 @@
 
 namespace Common {
 
+/**
+ * Maximal number of bits resolved with a single table lookup. Longer codes
+ * are rare, and are looked up in the code lists.
+ */
+static const uint8 kMaxPrefixBits = 9;
+
 Huffman::Symbol::Symbol(uint32 c, uint32 s) : code(c), symbol(s) {
 }
 
@@ -58,6 +64,9 @@ Huffman::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *codes, const u
 		// And put the pointer to the symbol/code struct into the symbol list.
 		_symbols[i] = &_codes[lengths[i] - 1].back();
 	}
+
+	_prefixBits = MIN(maxLength, kMaxPrefixBits);
+	buildPrefixTables();
 }
 
 Huffman::~Huffman() {
@@ -66,12 +75,64 @@ Huffman::~Huffman() {
 void Huffman::setSymbols(const uint32 *symbols) {
 	for (uint32 i = 0; i < _symbols.size(); i++)
 		_symbols[i]->symbol = symbols ? *symbols++ : i;
+
+	buildPrefixTables();
+}
+
+void Huffman::buildPrefixTables() {
+	_prefixMSB.clear();
+	_prefixLSB.clear();
+	_prefixMSB.resize(1 << _prefixBits);
+	_prefixLSB.resize(1 << _prefixBits);
+
+	for (uint32 length = 1; length <= _prefixBits; length++) {
+		// A code fills all entries starting with it, whatever bits follow
+		const uint32 fill = 1 << (_prefixBits - length);
+
+		for (CodeList::const_iterator cCode = _codes[length - 1].begin(); cCode != _codes[length - 1].end(); ++cCode) {
+			// Such a code can never be read, skip it
+			if (cCode->code >> length)
+				continue;
+
+			for (uint32 rest = 0; rest < fill; rest++) {
+				// Like in the code lists, the first and shortest code wins
+				PrefixEntry &msb = _prefixMSB[(cCode->code << (_prefixBits - length)) | rest];
+				if (!msb.length) {
+					msb.symbol = cCode->symbol;
+					msb.length = length;
+				}
+
+				PrefixEntry &lsb = _prefixLSB[cCode->code | (rest << length)];
+				if (!lsb.length) {
+					lsb.symbol = cCode->symbol;
+					lsb.length = length;
+				}
+			}
+		}
+	}
 }
 
 uint32 Huffman::getSymbol(BitStream &bits) const {
 	uint32 code = 0;
+	uint32 i = 0;
+
+	// Resolve the short codes with a single lookup, as long as there are
+	// enough bits left to peek at
+	if (bits.size() - bits.pos() >= _prefixBits) {
+		code = bits.peekBits(_prefixBits);
+
+		const PrefixEntry &entry = bits.isMSBFirst() ? _prefixMSB[code] : _prefixLSB[code];
+		if (entry.length) {
+			bits.skip(entry.length);
+			return entry.symbol;
+		}
+
+		// The code is longer, continue after the bits we already have
+		bits.skip(_prefixBits);
+		i = _prefixBits;
+	}
 
-	for (uint32 i = 0; i < _codes.size(); i++) {
+	for (; i < _codes.size(); i++) {
 		bits.addBit(code, i);
 
 		for (CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
@@ -66,15 +66,36 @@ private:
 		Symbol(uint32 c, uint32 s);
 	};
 
+	/** An entry in the prefix lookup tables. */
+	struct PrefixEntry {
+		uint32 symbol;
+		uint8 length; ///< Length of the code, 0 if it is longer than the prefix.
+
+		PrefixEntry() : symbol(0), length(0) {}
+	};
+
 	typedef List<Symbol> CodeList;
 	typedef Array<CodeList> CodeLists;
 	typedef Array<Symbol *> SymbolList;
+	typedef Array<PrefixEntry> PrefixTable;
 
 	/** Lists of codes and their symbols, sorted by code length. */
 	CodeLists _codes;
 
 	/** Sorted list of pointers to the symbols. */
 	SymbolList _symbols;
+
+	/** Number of bits looked up at once in the prefix tables. */
+	uint8 _prefixBits;
+
+	/**
+	 * Symbols of all codes up to _prefixBits long, indexed by the next
+	 * _prefixBits bits of the stream, for both bit orders.
+	 */
+	PrefixTable _prefixMSB;
+	PrefixTable _prefixLSB;
+
+	void buildPrefixTables();
 };
 
 } // End of namespace Common
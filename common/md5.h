@@ -24,12 +24,59 @@
 #define COMMON_MD5_H
 
 #include "common/scummsys.h"
+#include "common/hash-str.h"
 
 namespace Common {
 
+class FSList;
 class ReadStream;
 class String;
 
+/**
+ * Incremental MD5 computation.
+ *
+ * Data can be added in as many pieces as convenient, for example directly
+ * from memory which is already loaded, without first wrapping it into a
+ * stream.
+ */
+class MD5 {
+public:
+	MD5();
+
+	/** Start over with a new checksum. */
+	void reset();
+
+	/** Add length bytes of data to the checksum. */
+	void update(const void *data, uint32 length);
+
+	/**
+	 * Add the content of the given ReadStream to the checksum.
+	 * @param[in] stream	the stream to read the data from
+	 * @param[in] length	the maximal number of bytes to read; 0 means all
+	 * @return the number of bytes read
+	 */
+	uint32 update(ReadStream &stream, uint32 length = 0);
+
+	/**
+	 * Finish the computation and return the 128 bit checksum in digest.
+	 * Call reset() before using the object for another checksum.
+	 */
+	void finish(uint8 digest[16]);
+
+	/** Finish the computation and return the checksum as a hex string. */
+	String finishAsString();
+
+	/** Convert a 128 bit checksum to a lowercase hex string of length 32. */
+	static String digestToString(const uint8 digest[16]);
+
+private:
+	uint32 _total[2];
+	uint32 _state[4];
+	uint8 _buffer[64];
+
+	void process(const uint8 data[64]);
+};
+
 /**
  * Compute the MD5 checksum of the content of the given ReadStream.
  * The 128 bit MD5 checksum is returned directly in the array digest.
@@ -54,6 +101,17 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length = 0);
  */
 String computeStreamMD5AsString(ReadStream &stream, uint32 length = 0);
 
+/**
+ * Compute the MD5 checksums of all files in the given list, for example of
+ * a whole game directory. Directories and files which cannot be opened are
+ * skipped.
+ * @param[in] files	the files of which the checksums are computed
+ * @param[out] md5s	receives the checksums as hex strings, keyed by file name
+ * @param[in] length	the number of bytes of each file for which to compute the checksum; 0 means all
+ * @return the number of files for which a checksum was computed
+ */
+uint computeFilesMD5(const FSList &files, StringMap &md5s, uint32 length = 0);
+
 } // End of namespace Common
 
 #endif
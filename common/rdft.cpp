@@ -25,6 +25,7 @@
 // Copyright (c) 2009 Alex Converse <alex dot converse at gmail dot com>
 
 #include "common/rdft.h"
+#include "common/fft-sse.h"
 
 namespace Common {
 
@@ -46,6 +47,61 @@ RDFT::~RDFT() {
 	delete _fft;
 }
 
+#ifdef FFT_USE_SSE
+
+/* Does the even/odd separation of calc() two coefficients at a time, from i=1
+ * as long as there are two left. Returns the first i it did not handle. The
+ * operations are done in the same order as in calc(), so the results match. */
+static int separateSSE(float *data, int n, const float *tCos, const float *tSin, float k1, float k2) {
+	// Sign masks for the (re, im, re, im) lanes
+	const __m128 negIm = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+	const __m128 negRe = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+	const __m128 vk1 = _mm_set1_ps(k1);
+	const __m128 vk2 = _mm_set1_ps(k2);
+
+	int i;
+	for (i = 1; (i + 1) < (n >> 2); i += 2) {
+		float * const p1 = data + 2 * i;
+		float * const p2 = data + n - 2 * i - 2;
+
+		// Coefficients i and i + 1, and n/2 - i and n/2 - i - 1
+		const __m128 x = _mm_loadu_ps(p1);
+		__m128 y = _mm_loadu_ps(p2);
+		y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 0, 3, 2));
+
+		__m128 c = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(tCos + i));
+		__m128 s = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(tSin + i));
+		c = _mm_unpacklo_ps(c, c);
+		s = _mm_unpacklo_ps(s, s);
+
+		const __m128 sum  = _mm_add_ps(x, y);
+		const __m128 diff = _mm_sub_ps(x, y);
+
+		// Separate even and odd FFTs: (sum.re, diff.im) and (sum.im, diff.re)
+		const __m128 evIn = _mm_shuffle_ps(sum, diff, _MM_SHUFFLE(3, 1, 2, 0));
+		const __m128 odIn = _mm_shuffle_ps(sum, diff, _MM_SHUFFLE(2, 0, 3, 1));
+
+		const __m128 ev = _mm_mul_ps(vk1, _mm_shuffle_ps(evIn, evIn, _MM_SHUFFLE(3, 1, 2, 0)));
+		const __m128 od = _mm_xor_ps(_mm_mul_ps(vk2, _mm_shuffle_ps(odIn, odIn, _MM_SHUFFLE(3, 1, 2, 0))), negIm);
+
+		// Apply twiddle factors to the odd FFT and add to the even FFT
+		const __m128 odC = _mm_mul_ps(od, c);
+		const __m128 odS = _mm_mul_ps(_mm_shuffle_ps(od, od, _MM_SHUFFLE(2, 3, 0, 1)), s);
+
+		const __m128 outX = _mm_add_ps(_mm_add_ps(ev, odC), _mm_xor_ps(odS, negRe));
+		__m128 outY = _mm_add_ps(_mm_add_ps(_mm_xor_ps(ev, negIm), _mm_xor_ps(odC, negRe)), odS);
+		outY = _mm_shuffle_ps(outY, outY, _MM_SHUFFLE(1, 0, 3, 2));
+
+		_mm_storeu_ps(p1, outX);
+		_mm_storeu_ps(p2, outY);
+	}
+
+	return i;
+}
+
+#endif // FFT_USE_SSE
+
 void RDFT::calc(float *data) {
 	const int n = 1 << _bits;
 
@@ -67,8 +123,11 @@ void RDFT::calc(float *data) {
 	data[0] = ev.re + data[1];
 	data[1] = ev.re - data[1];
 
-	int i;
-	for (i = 1; i < (n >> 2); i++) {
+	int i = 1;
+#ifdef FFT_USE_SSE
+	i = separateSSE(data, n, _tCos, _tSin, k1, k2);
+#endif
+	for (; i < (n >> 2); i++) {
 		int i1 = 2 * i;
 		int i2 = n - i1;
 
@@ -65,6 +65,7 @@ class SaveFileManager : NonCopyable {
 protected:
 	Error _error;
 	String _errorDesc;
+	uint32 _changeCounter;
 
 	/**
 	 * Set some information about the last error which occurred .
@@ -73,7 +74,15 @@ protected:
 	 */
 	virtual void setError(Error error, const String &errorDesc) { _error = error; _errorDesc = errorDesc; }
 
+	/**
+	 * Has to be called by implementations whenever a savefile is opened for
+	 * saving or removed.
+	 * @see getChangeCounter
+	 */
+	void savefilesChanged() { ++_changeCounter; }
+
 public:
+	SaveFileManager() : _changeCounter(0) {}
 	virtual ~SaveFileManager() {}
 
 	/**
@@ -161,6 +170,14 @@ public:
 	 * @see Common::matchString()
 	 */
 	virtual StringArray listSavefiles(const String &pattern) = 0;
+
+	/**
+	 * Returns a counter which is increased whenever a savefile is opened for
+	 * saving or removed. This allows code keeping information read from
+	 * savefiles to find out whether it might be outdated.
+	 * @return the current value of the counter
+	 */
+	uint32 getChangeCounter() const { return _changeCounter; }
 };
 
 } // End of namespace Common
@@ -34,6 +34,7 @@ XMLParser::~XMLParser() {
 
 	delete _XMLkeys;
 	delete _stream;
+	delete[] _buffer;
 
 	for (List<XMLKeyLayout *>::iterator i = _layoutList.begin();
 		i != _layoutList.end(); ++i)
@@ -75,12 +76,16 @@ bool XMLParser::loadStream(SeekableReadStream *stream) {
 void XMLParser::close() {
 	delete _stream;
 	_stream = 0;
+
+	delete[] _buffer;
+	_buffer = 0;
+	_bufferSize = _bufferPos = 0;
 }
 
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
-	const int startPosition = _stream->pos();
+	const int startPosition = _bufferPos;
 	int currentPosition = startPosition;
 	int lineCount = 1;
 	char c = 0;
@@ -167,7 +172,7 @@ bool XMLParser::parseActiveKey(bool closed) {
 	if (layout->children.contains(key->name)) {
 		key->layout = layout->children[key->name];
 
-		StringMap localMap = key->values;
+		const StringMap &localMap = key->values;
 		int keyCount = localMap.size();
 
 		for (List<XMLKeyLayout::XMLKeyProperty>::const_iterator i = key->layout->properties.begin(); i != key->layout->properties.end(); ++i) {
@@ -218,17 +223,17 @@ bool XMLParser::parseKeyValue(String keyName) {
 
 	if (_char == '"' || _char == '\'') {
 		stringStart = _char;
-		_char = _stream->readByte();
+		_char = nextChar();
 
 		while (_char && _char != stringStart) {
 			_token += _char;
-			_char = _stream->readByte();
+			_char = nextChar();
 		}
 
 		if (_char == 0)
 			return false;
 
-		_char = _stream->readByte();
+		_char = nextChar();
 
 	} else if (!parseToken()) {
 		return false;
@@ -300,8 +305,16 @@ bool XMLParser::parse() {
 	if (_stream == 0)
 		return false;
 
-	// Make sure we are at the start of the stream.
+	// The parser looks at every single character, so the whole file is read
+	// at once instead of going through the stream for each of them.
+	delete[] _buffer;
 	_stream->seek(0, SEEK_SET);
+	_bufferSize = _stream->size();
+	_buffer = new byte[_bufferSize];
+	_bufferPos = 0;
+
+	if (_stream->read(_buffer, _bufferSize) != _bufferSize)
+		return false;
 
 	if (_XMLkeys == 0)
 		buildLayout();
@@ -318,7 +331,7 @@ bool XMLParser::parse() {
 	_state = kParserNeedHeader;
 	_activeKey.clear();
 
-	_char = _stream->readByte();
+	_char = nextChar();
 
 	while (_char && _state != kParserError) {
 		if (skipSpaces())
@@ -335,7 +348,7 @@ bool XMLParser::parse() {
 				break;
 			}
 
-			if ((_char = _stream->readByte()) == 0) {
+			if ((_char = nextChar()) == 0) {
 				parserError("Unexpected end of file.");
 				break;
 			}
@@ -346,10 +359,10 @@ bool XMLParser::parse() {
 					break;
 				}
 
-				_char = _stream->readByte();
+				_char = nextChar();
 				activeHeader = true;
 			} else if (_char == '/') {
-				_char = _stream->readByte();
+				_char = nextChar();
 				activeClosure = true;
 			} else if (_char == '?') {
 				parserError("Unexpected header. There may only be one XML header per file.");
@@ -397,7 +410,7 @@ bool XMLParser::parse() {
 				else
 					_state = kParserNeedKey;
 
-				_char = _stream->readByte();
+				_char = nextChar();
 				break;
 			}
 
@@ -405,14 +418,14 @@ bool XMLParser::parse() {
 
 			if (_char == '/' || (_char == '?' && activeHeader)) {
 				selfClosure = true;
-				_char = _stream->readByte();
+				_char = nextChar();
 			}
 
 			if (_char == '>') {
 				if (activeHeader && !selfClosure) {
 					parserError("XML Header must be self-closed.");
 				} else if (parseActiveKey(selfClosure)) {
-					_char = _stream->readByte();
+					_char = nextChar();
 					_state = kParserNeedKey;
 				}
 
@@ -435,7 +448,7 @@ bool XMLParser::parse() {
 			else
 				_state = kParserNeedPropertyValue;
 
-			_char = _stream->readByte();
+			_char = nextChar();
 			break;
 
 		case kParserNeedPropertyValue:
@@ -465,39 +478,39 @@ bool XMLParser::skipSpaces() {
 		return false;
 
 	while (_char && isSpace(_char))
-		_char = _stream->readByte();
+		_char = nextChar();
 
 	return true;
 }
 
 bool XMLParser::skipComments() {
 	if (_char == '<') {
-		_char = _stream->readByte();
+		_char = nextChar();
 
 		if (_char != '!') {
-			_stream->seek(-1, SEEK_CUR);
+			--_bufferPos;
 			_char = '<';
 			return false;
 		}
 
-		if (_stream->readByte() != '-' || _stream->readByte() != '-')
+		if (nextChar() != '-' || nextChar() != '-')
 			return parserError("Malformed comment syntax.");
 
-		_char = _stream->readByte();
+		_char = nextChar();
 
 		while (_char) {
 			if (_char == '-') {
-				if (_stream->readByte() == '-') {
+				if (nextChar() == '-') {
 
-					if (_stream->readByte() != '>')
+					if (nextChar() != '>')
 						return parserError("Malformed comment (double-hyphen inside comment body).");
 
-					_char = _stream->readByte();
+					_char = nextChar();
 					return true;
 				}
 			}
 
-			_char = _stream->readByte();
+			_char = nextChar();
 		}
 
 		return parserError("Comment has no closure.");
@@ -511,7 +524,7 @@ bool XMLParser::parseToken() {
 
 	while (isValidNameChar(_char)) {
 		_token += _char;
-		_char = _stream->readByte();
+		_char = nextChar();
 	}
 
 	return isSpace(_char) != 0 || _char == '>' || _char == '=' || _char == '/';
@@ -92,7 +92,7 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(0), _stream(0) {}
+	XMLParser() : _XMLkeys(0), _stream(0), _buffer(0), _bufferSize(0), _bufferPos(0) {}
 
 	virtual ~XMLParser();
 
@@ -341,6 +341,15 @@ private:
 	SeekableReadStream *_stream;
 	String _fileName;
 
+	/** Contents of the stream being parsed */
+	byte *_buffer;
+	uint32 _bufferSize;
+	uint32 _bufferPos;
+
+	char nextChar() {
+		return _bufferPos < _bufferSize ? _buffer[_bufferPos++] : 0;
+	}
+
 	ParserState _state; /** Internal state of the parser */
 
 	String _error; /** Current error message */
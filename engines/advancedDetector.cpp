@@ -33,6 +33,33 @@
 #include "engines/advancedDetector.h"
 #include "engines/obsolete.h"
 
+namespace Common {
+DECLARE_SINGLETON(ADCacheManager);
+}
+
+Common::String ADCacheManager::makeKey(const Common::String &path, uint32 md5Bytes, bool resFork) {
+	return Common::String::format("%s:%d:%s", resFork ? "r" : "d", md5Bytes, path.c_str());
+}
+
+bool ADCacheManager::getFileProperties(const Common::String &path, uint32 md5Bytes, bool resFork, ADFileProperties &fileProps) const {
+	if (!_enableCount)
+		return false;
+
+	Common::HashMap<Common::String, ADFileProperties>::const_iterator i = _fileProps.find(makeKey(path, md5Bytes, resFork));
+	if (i == _fileProps.end())
+		return false;
+
+	fileProps = i->_value;
+	return true;
+}
+
+void ADCacheManager::setFileProperties(const Common::String &path, uint32 md5Bytes, bool resFork, const ADFileProperties &fileProps) {
+	if (!_enableCount)
+		return;
+
+	_fileProps[makeKey(path, md5Bytes, resFork)] = fileProps;
+}
+
 static GameDescriptor toGameDescriptor(const ADGameDescription &g, const PlainGameDescriptor *sg) {
 	const char *title = 0;
 	const char *extra;
@@ -373,6 +400,10 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 	// file and as one with resource fork.
 
 	if (game.flags & ADGF_MACRESFORK) {
+		const Common::String path = parent.getChild(fname).getPath();
+		if (ADCacheMan.getFileProperties(path, _md5Bytes, true, fileProps))
+			return true;
+
 		Common::MacResManager macResMan;
 
 		if (!macResMan.open(parent, fname))
@@ -380,12 +411,17 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 
 		fileProps.md5 = macResMan.computeResForkMD5AsString(_md5Bytes);
 		fileProps.size = macResMan.getResForkDataSize();
+		ADCacheMan.setFileProperties(path, _md5Bytes, true, fileProps);
 		return true;
 	}
 
 	if (!allFiles.contains(fname))
 		return false;
 
+	const Common::String path = allFiles[fname].getPath();
+	if (ADCacheMan.getFileProperties(path, _md5Bytes, false, fileProps))
+		return true;
+
 	Common::File testFile;
 
 	if (!testFile.open(allFiles[fname]))
@@ -393,6 +429,7 @@ bool AdvancedMetaEngine::getFileProperties(const Common::FSNode &parent, const F
 
 	fileProps.size = (int32)testFile.size();
 	fileProps.md5 = Common::computeStreamMD5AsString(testFile, _md5Bytes);
+	ADCacheMan.setFileProperties(path, _md5Bytes, false, fileProps);
 	return true;
 }
 
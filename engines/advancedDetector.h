@@ -27,6 +27,7 @@
 #include "engines/engine.h"
 
 #include "common/hash-str.h"
+#include "common/singleton.h"
 
 #include "common/gui_options.h" // FIXME: Temporary hack?
 
@@ -61,6 +62,51 @@ struct ADFileProperties {
  */
 typedef Common::HashMap<Common::String, ADFileProperties, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> ADFilePropertiesMap;
 
+/**
+ * Remembers the sizes and MD5 checksums of the files looked at during a
+ * detection run. The detectors of different engines often check the same
+ * files, which then only need to be read once.
+ *
+ * The cache is only used while it is enabled through an ADCacheScope, which
+ * EngineManager::detectGames() sets up for each run. Everything is thrown
+ * away when the scope ends, so that changes to the files between runs, and
+ * detection outside of such a run (e.g. when starting a game), always see
+ * the files as they are.
+ */
+class ADCacheManager : public Common::Singleton<ADCacheManager> {
+public:
+	/** Look up the properties of the first md5Bytes bytes of a file. */
+	bool getFileProperties(const Common::String &path, uint32 md5Bytes, bool resFork, ADFileProperties &fileProps) const;
+	void setFileProperties(const Common::String &path, uint32 md5Bytes, bool resFork, const ADFileProperties &fileProps);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	friend class ADCacheScope;
+
+	ADCacheManager() : _enableCount(0) {}
+
+	static Common::String makeKey(const Common::String &path, uint32 md5Bytes, bool resFork);
+
+	Common::HashMap<Common::String, ADFileProperties> _fileProps;
+	int _enableCount;
+};
+
+/** Shortcut for accessing the detection cache. */
+#define ADCacheMan ADCacheManager::instance()
+
+/**
+ * Enables the detection cache for the lifetime of this object. The cache is
+ * cleared when the outermost scope ends.
+ */
+class ADCacheScope {
+public:
+	ADCacheScope() { ADCacheMan._enableCount++; }
+	~ADCacheScope() {
+		if (!--ADCacheMan._enableCount)
+			ADCacheMan._fileProps.clear();
+	}
+};
+
 /**
  * A shortcut to produce an empty ADGameFileDescription record. Used to mark
  * the end of a list of these.
@@ -465,8 +465,9 @@ int AgiEngine::agiLoadResource(int r, int n) {
 	// The picture can be seen in room 147 after dropping through the outhouse's hole in room 146.
 	if (i == errOK && getGameID() == GID_GOLDRUSH && r == rPICTURE && n == 147 && _game.dirPic[n].len == 1982) {
 		uint8 *pic = _game.pictures[n].rdata;
-		Common::MemoryReadStream picStream(pic, _game.dirPic[n].len);
-		Common::String md5str = Common::computeStreamMD5AsString(picStream, _game.dirPic[n].len);
+		Common::MD5 md5;
+		md5.update(pic, _game.dirPic[n].len);
+		Common::String md5str = md5.finishAsString();
 		if (md5str == "1c685eb048656cedcee4eb6eca2cecea") {
 			pic[0x042] = 0x4B; // 0x49 -> 0x4B
 			pic[0x043] = 0x66; // 0x26 -> 0x66
@@ -50,6 +50,8 @@ void Debugger::initialize() {
 	registerCmd("queryflag",          WRAP_METHOD(Debugger, cmdQueryFlag));
 	registerCmd("timers",             WRAP_METHOD(Debugger, cmdListTimers));
 	registerCmd("settimercountdown",  WRAP_METHOD(Debugger, cmdSetTimerCountdown));
+	if (_vm->game() == GI_KYRA2 || _vm->game() == GI_KYRA3 || _vm->game() == GI_LOL)
+		registerCmd("shape_benchmark",    WRAP_METHOD(Debugger, cmdShapeBenchmark));
 }
 
 bool Debugger::cmdSetScreenDebug(int argc, const char **argv) {
@@ -197,6 +199,67 @@ bool Debugger::cmdSetTimerCountdown(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdShapeBenchmark(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Syntax: shape_benchmark <shape file> [iterations]\n");
+		return true;
+	}
+
+	uint32 fileSize = 0;
+	uint8 *shpFile = _vm->resource()->fileData(argv[1], &fileSize);
+	if (!shpFile || fileSize < 2) {
+		debugPrintf("Can't load shape file '%s'\n", argv[1]);
+		delete[] shpFile;
+		return true;
+	}
+
+	const int iterations = (argc > 2) ? atoi(argv[2]) : 100;
+	const int numShapes = READ_LE_UINT16(shpFile);
+	if (fileSize < 2u + numShapes * 4u) {
+		debugPrintf("'%s' is not a shape collection\n", argv[1]);
+		delete[] shpFile;
+		return true;
+	}
+
+	// Draw every shape of the file with each of the scaling and flipping
+	// modes. The drawing goes to page 2, which is restored afterwards.
+	static const int modes[] = {
+		0,
+		Screen::DSF_X_FLIPPED,
+		Screen::DSF_Y_FLIPPED,
+		Screen::DSF_SCALE,
+		Screen::DSF_SCALE | Screen::DSF_X_FLIPPED
+	};
+
+	Screen *screen = _vm->screen();
+	uint8 *pageBackup = new uint8[Screen::SCREEN_W * Screen::SCREEN_H];
+	screen->copyRegionToBuffer(2, 0, 0, Screen::SCREEN_W, Screen::SCREEN_H, pageBackup);
+
+	uint32 shapesDrawn = 0;
+	const uint32 start = g_system->getMillis();
+	for (int n = 0; n < iterations; ++n) {
+		for (int i = 0; i < numShapes; ++i) {
+			const uint32 offset = READ_LE_UINT32(shpFile + (i << 2) + 2);
+			if (!offset || offset + 2 >= fileSize)
+				continue;
+
+			const uint8 *shape = shpFile + offset + 2;
+			for (int j = 0; j < ARRAYSIZE(modes); ++j) {
+				screen->drawShape(2, shape, 160, 100, 0, modes[j] | Screen::DSF_CENTER, 0xC0, 0xA0);
+				++shapesDrawn;
+			}
+		}
+	}
+	const uint32 elapsed = g_system->getMillis() - start;
+
+	screen->copyBlockToPage(2, 0, 0, Screen::SCREEN_W, Screen::SCREEN_H, pageBackup);
+	delete[] pageBackup;
+	delete[] shpFile;
+
+	debugPrintf("Drew %d shapes (%d in file) in %d ms\n", shapesDrawn, numShapes, elapsed);
+	return true;
+}
+
 #pragma mark -
 
 Debugger_LoK::Debugger_LoK(KyraEngine_LoK *vm)
@@ -51,6 +51,7 @@ protected:
 	bool cmdQueryFlag(int argc, const char **argv);
 	bool cmdListTimers(int argc, const char **argv);
 	bool cmdSetTimerCountdown(int argc, const char **argv);
+	bool cmdShapeBenchmark(int argc, const char **argv);
 };
 
 class Debugger_LoK : public Debugger {
@@ -1462,68 +1462,73 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		&Screen::drawShapeSkipScaleDownwind
 	};
 
-	static const DsLineFunc dsLineFunc[] = {
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineNoScaleUpwind,
-		&Screen::drawShapeProcessLineNoScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind,
-		&Screen::drawShapeProcessLineScaleUpwind,
-		&Screen::drawShapeProcessLineScaleDownwind
+#define DS_LINE_FUNCS(plot) { \
+		&Screen::drawShapeProcessLineNoScaleUpwind<&Screen::drawShapePlotType##plot>, \
+		&Screen::drawShapeProcessLineNoScaleDownwind<&Screen::drawShapePlotType##plot>, \
+		&Screen::drawShapeProcessLineScaleUpwind<&Screen::drawShapePlotType##plot>, \
+		&Screen::drawShapeProcessLineScaleDownwind<&Screen::drawShapePlotType##plot> \
+	}
+#define DS_LINE_NONE { 0, 0, 0, 0 }
+
+	static const DsLineFunc dsLineFunc[][4] = {
+		DS_LINE_FUNCS(0),		// used by Kyra 1 + 2
+		DS_LINE_FUNCS(1),		// used by Kyra 3
+		DS_LINE_NONE,
+		DS_LINE_FUNCS(3_7),		// used by Kyra 3 (shadow)
+		DS_LINE_FUNCS(4),		// used by Kyra 1, 2 + 3
+		DS_LINE_FUNCS(5),		// used by Kyra 1
+		DS_LINE_FUNCS(6),		// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(3_7),		// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(8),		// used by Kyra 2
+		DS_LINE_FUNCS(9),		// used by Kyra 1 + 3
+		DS_LINE_NONE,
+		DS_LINE_FUNCS(11_15),	// used by Kyra 1 (invisibility) + Kyra 3 (shadow)
+		DS_LINE_FUNCS(12),		// used by Kyra 2
+		DS_LINE_FUNCS(13),		// used by Kyra 1
+		DS_LINE_FUNCS(14),		// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(11_15),	// used by Kyra 1 (invisibility)
+		DS_LINE_FUNCS(16),		// used by LoL PC-98/16 Colors (teleporters),
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_FUNCS(20),		// used by LoL (heal spell effect)
+		DS_LINE_FUNCS(21),		// used by LoL (white tower spirits)
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_NONE,
+		DS_LINE_FUNCS(33),		// used by LoL (blood spots on the floor)
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_FUNCS(37),		// used by LoL (monsters)
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_FUNCS(48),		// used by LoL (slime spots on the floor)
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_FUNCS(52),		// used by LoL (projectiles)
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE, DS_LINE_NONE,
+		DS_LINE_NONE
 	};
 
-	static const DsPlotFunc dsPlotFunc[] = {
-		&Screen::drawShapePlotType0,		// used by Kyra 1 + 2
-		&Screen::drawShapePlotType1,		// used by Kyra 3
-		0,
-		&Screen::drawShapePlotType3_7,		// used by Kyra 3 (shadow)
-		&Screen::drawShapePlotType4,		// used by Kyra 1, 2 + 3
-		&Screen::drawShapePlotType5,		// used by Kyra 1
-		&Screen::drawShapePlotType6,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType3_7,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType8,		// used by Kyra 2
-		&Screen::drawShapePlotType9,		// used by Kyra 1 + 3
-		0,
-		&Screen::drawShapePlotType11_15,	// used by Kyra 1 (invisibility) + Kyra 3 (shadow)
-		&Screen::drawShapePlotType12,		// used by Kyra 2
-		&Screen::drawShapePlotType13,		// used by Kyra 1
-		&Screen::drawShapePlotType14,		// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType11_15,	// used by Kyra 1 (invisibility)
-		&Screen::drawShapePlotType16,		// used by LoL PC-98/16 Colors (teleporters),
-		0, 0, 0,
-		&Screen::drawShapePlotType20,		// used by LoL (heal spell effect)
-		&Screen::drawShapePlotType21,		// used by LoL (white tower spirits)
-		0, 0, 0, 0,	0, 0, 0, 0, 0, 0,
-		0,
-		&Screen::drawShapePlotType33,		// used by LoL (blood spots on the floor)
-		0, 0, 0,
-		&Screen::drawShapePlotType37,		// used by LoL (monsters)
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-		&Screen::drawShapePlotType48,		// used by LoL (slime spots on the floor)
-		0, 0, 0,
-		&Screen::drawShapePlotType52,		// used by LoL (projectiles)
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-		0
-	};
+#undef DS_LINE_FUNCS
+#undef DS_LINE_NONE
 
 	int scaleCounterV = 0;
 
 	const int drawFunc = flags & 0x0F;
 	_dsProcessMargin = dsMarginFunc[drawFunc];
 	_dsScaleSkip = dsSkipFunc[drawFunc];
-	_dsProcessLine = dsLineFunc[drawFunc];
 
+	// Select the line function specialized for both the scaling/flipping
+	// mode and the plotting method. Only the choice between the normal and
+	// the masked variant (flag 0x800) is left to be made per line.
+	const int lineFunc = ((drawFunc & 4) >> 1) | (drawFunc & 1);
 	const int ppc = (flags >> 8) & 0x3F;
-	_dsPlot = dsPlotFunc[ppc];
-	DsPlotFunc dsPlot2 = dsPlotFunc[ppc], dsPlot3 = dsPlotFunc[ppc];
+	DsLineFunc dsLine2 = dsLineFunc[ppc][lineFunc], dsLine3 = dsLineFunc[ppc][lineFunc];
 	if (flags & 0x800)
-		dsPlot3 = dsPlotFunc[((flags >> 8) & 0xF7) & 0x3F];
+		dsLine3 = dsLineFunc[((flags >> 8) & 0xF7) & 0x3F][lineFunc];
 
-	if (!_dsPlot || !dsPlot2 || !dsPlot3) {
-		if (!dsPlot2)
+	if (!dsLine2 || !dsLine3) {
+		if (!dsLine2)
 			warning("Missing drawShape plotting method type %d", ppc);
-		if (dsPlot3 != dsPlot2 && !dsPlot3)
+		if (dsLine3 != dsLine2 && !dsLine3)
 			warning("Missing drawShape plotting method type %d", (((flags >> 8) & 0xF7) & 0x3F));
 		return;
 	}
@@ -1706,8 +1711,7 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 				if (cnt > 0) {
 					if (flags & 0x800)
 						normalPlot = (curY > _maskMinY && curY < _maskMaxY);
-					_dsPlot = normalPlot ? dsPlot2 : dsPlot3;
-					(this->*_dsProcessLine)(d, src, cnt, scaleState);
+					(this->*(normalPlot ? dsLine2 : dsLine3))(d, src, cnt, scaleState);
 				}
 				cnt += _dsOffscreenRight;
 				if (cnt)
@@ -1835,12 +1839,13 @@ int Screen::drawShapeSkipScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt)
 	return found ? 0 : _dsOffscreenScaleVal1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst++;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1850,12 +1855,13 @@ void Screen::drawShapeProcessLineNoScaleUpwind(uint8 *&dst, const uint8 *&src, i
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
 	do {
 		uint8 c = *src++;
 		if (c) {
 			uint8 *d = dst--;
-			(this->*_dsPlot)(d, c);
+			(this->*plot)(d, c);
 			cnt--;
 		} else {
 			c = *src++;
@@ -1865,6 +1871,7 @@ void Screen::drawShapeProcessLineNoScaleDownwind(uint8 *&dst, const uint8 *&src,
 	} while (cnt > 0);
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1884,7 +1891,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 				scaleState = r & 0xFF;
 			}
 		} else if (scaleState) {
-			(this->*_dsPlot)(dst++, c);
+			(this->*plot)(dst++, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -1893,6 +1900,7 @@ void Screen::drawShapeProcessLineScaleUpwind(uint8 *&dst, const uint8 *&src, int
 	cnt = -1;
 }
 
+template<Screen::DsPlotFunc plot>
 void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
 	int c = 0;
 
@@ -1912,7 +1920,7 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 				scaleState = r & 0xFF;
 			}
 		} else {
-			(this->*_dsPlot)(dst--, c);
+			(this->*plot)(dst--, c);
 			scaleState -= 0x100;
 			cnt--;
 		}
@@ -223,21 +223,18 @@ bool VideoManager::updateMovies() {
 
 		// Check if we need to draw a frame
 		if (_videoStreams[i]->needsUpdate()) {
-			const Graphics::Surface *frame = _videoStreams[i]->decodeNextFrame();
-			Graphics::Surface *convertedFrame = 0;
+			Graphics::PixelFormat pixelFormat = _vm->_system->getScreenFormat();
+			const Graphics::Surface *frame;
 
-			if (frame && _videoStreams[i].enabled) {
-				Graphics::PixelFormat pixelFormat = _vm->_system->getScreenFormat();
-
-				if (frame->format != pixelFormat) {
-					// We don't support downconverting to 8bpp
-					if (pixelFormat.bytesPerPixel == 1)
-						error("Cannot convert high color video frame to 8bpp");
+			// Convert to the current screen format, if the video is shown.
+			// Downconverting to 8bpp is not supported.
+			if (_videoStreams[i].enabled)
+				frame = _videoStreams[i]->decodeNextConvertedFrame(pixelFormat);
+			else
+				frame = _videoStreams[i]->decodeNextFrame();
 
-					// Convert to the current screen format
-					convertedFrame = frame->convertTo(pixelFormat, _videoStreams[i]->getPalette());
-					frame = convertedFrame;
-				} else if (pixelFormat.bytesPerPixel == 1 && _videoStreams[i]->hasDirtyPalette()) {
+			if (frame && _videoStreams[i].enabled) {
+				if (pixelFormat.bytesPerPixel == 1 && _videoStreams[i]->hasDirtyPalette()) {
 					// Set the palette when running in 8bpp mode only
 					_vm->_system->getPaletteManager()->setPalette(_videoStreams[i]->getPalette(), 0, 256);
 				}
@@ -249,12 +246,6 @@ bool VideoManager::updateMovies() {
 
 				// We've drawn something to the screen, make sure we update it
 				updateScreen = true;
-
-				// Delete 8bpp conversion surface
-				if (convertedFrame) {
-					convertedFrame->free();
-					delete convertedFrame;
-				}
 			}
 		}
 
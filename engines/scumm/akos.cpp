@@ -358,6 +358,68 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	}
 }
 
+enum {
+	// Upper bound for the memory taken by decoded limbs
+	kDecodedLimbsMaxSize = 1024 * 1024
+};
+
+AkosRenderer::~AkosRenderer() {
+	flushDecodedLimbs();
+}
+
+void AkosRenderer::flushDecodedLimbs() {
+	for (uint i = 0; i < _decodedLimbs.size(); ++i)
+		delete[] _decodedLimbs[i].pixels;
+	_decodedLimbs.clear();
+	_decodedLimbsSize = 0;
+}
+
+const byte *AkosRenderer::findDecodedLimb() {
+	// A freed costume may have been replaced by another one at the same
+	// address
+	if (_decodedLimbsGeneration != _vm->_res->getCostumeGeneration()) {
+		flushDecodedLimbs();
+		_decodedLimbsGeneration = _vm->_res->getCostumeGeneration();
+	}
+
+	for (uint i = 0; i < _decodedLimbs.size(); ++i) {
+		DecodedLimb &limb = _decodedLimbs[i];
+		if (limb.src == _srcptr && limb.width == _width && limb.height == _height) {
+			limb.lastUsed = ++_decodedLimbsClock;
+			return limb.pixels;
+		}
+	}
+	return 0;
+}
+
+byte *AkosRenderer::addDecodedLimb() {
+	const uint32 size = _width * _height;
+
+	// Throw out the least recently drawn limbs until the new one fits. A
+	// single limb is always kept, even if it is larger than the limit.
+	while (!_decodedLimbs.empty() && _decodedLimbsSize + size > kDecodedLimbsMaxSize) {
+		uint oldest = 0;
+		for (uint i = 1; i < _decodedLimbs.size(); ++i) {
+			if (_decodedLimbs[i].lastUsed < _decodedLimbs[oldest].lastUsed)
+				oldest = i;
+		}
+		_decodedLimbsSize -= _decodedLimbs[oldest].width * _decodedLimbs[oldest].height;
+		delete[] _decodedLimbs[oldest].pixels;
+		_decodedLimbs.remove_at(oldest);
+	}
+
+	DecodedLimb limb;
+	limb.src = _srcptr;
+	limb.width = _width;
+	limb.height = _height;
+	limb.pixels = new byte[size];
+	limb.lastUsed = ++_decodedLimbsClock;
+	_decodedLimbs.push_back(limb);
+	_decodedLimbsSize += size;
+
+	return limb.pixels;
+}
+
 void AkosRenderer::setFacing(const Actor *a) {
 	_mirror = (newDirToOldDir(a->getFacing()) != 0 || akhd->flags & 1);
 	if (a->_flip)
@@ -539,6 +601,64 @@ byte AkosRenderer::drawLimb(const Actor *a, int limb) {
 	return result;
 }
 
+void AkosRenderer::codec1_decodeLimb(byte *dst, const Codec1 &v1) {
+	const byte *src = _srcptr;
+	int left = _width * _height;
+
+	// The limb is stored column by column, and runs may continue into the
+	// next column
+	while (left > 0) {
+		byte len = *src++;
+		const byte color = len >> v1.shr;
+		len &= v1.mask;
+		if (!len)
+			len = *src++;
+
+		// A run length of zero means 256, like in codec1_genericDecode()
+		const int count = MIN<int>(len ? len : 256, left);
+		memset(dst, color, count);
+		dst += count;
+		left -= count;
+	}
+}
+
+void AkosRenderer::codec1_drawUnscaled(Codec1 &v1, const byte *pixels) {
+	// Only the rows within the bounds are visible, and without scaling
+	// they are the same for all columns
+	const int firstRow = MAX<int>(v1.boundsRect.top - v1.y, 0);
+	const int lastRow = MIN<int>(v1.boundsRect.bottom - v1.y, _height);
+	if (firstRow >= lastRow)
+		return;
+
+	const int y = v1.y + firstRow;
+	byte *dst = v1.destptr + firstRow * _out.pitch;
+	pixels += firstRow;
+
+	while (true) {
+		if (v1.x >= 0 && v1.x < v1.boundsRect.right) {
+			const byte maskbit = revBitMask(v1.x & 7);
+			const byte *mask = _vm->getMaskBuffer(v1.x - (_vm->_virtscr[kMainVirtScreen].xstart & 7), y, _zbuf);
+			byte *d = dst;
+
+			for (int row = firstRow; row < lastRow; ++row) {
+				const byte color = pixels[row - firstRow];
+				if (color && !(*mask & maskbit))
+					*d = _palette[color];
+				d += _out.pitch;
+				mask += _numStrips;
+			}
+		}
+
+		if (!--v1.skip_width)
+			return;
+		v1.x += v1.scaleXstep;
+		if (v1.x < 0 || v1.x >= v1.boundsRect.right)
+			return;
+		dst += v1.scaleXstep;
+		pixels += _height;
+	}
+}
+
 void AkosRenderer::codec1_genericDecode(Codec1 &v1) {
 	const byte *mask, *src;
 	byte *dst;
@@ -941,13 +1061,21 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.replen = 0;
 
+	// Unscaled limbs are drawn from the decoded limb cache, so the columns
+	// skipped on the left are not unpacked here
+	const bool useDecodedLimb = !use_scaling && !_actorHitMode && _shadow_mode == 0 && _vm->_bytesPerPixel == 1;
+	int skipColumns = 0;
+
 	if (_mirror) {
 		if (!use_scaling)
 			skip = v1.boundsRect.left - v1.x;
 
 		if (skip > 0) {
 			v1.skip_width -= skip;
-			codec1_ignorePakCols(v1, skip);
+			if (useDecodedLimb)
+				skipColumns = skip;
+			else
+				codec1_ignorePakCols(v1, skip);
 			v1.x = v1.boundsRect.left;
 		} else {
 			skip = rect.right - v1.boundsRect.right;
@@ -962,7 +1090,10 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 			skip = rect.right - v1.boundsRect.right + 1;
 		if (skip > 0) {
 			v1.skip_width -= skip;
-			codec1_ignorePakCols(v1, skip)	;
+			if (useDecodedLimb)
+				skipColumns = skip;
+			else
+				codec1_ignorePakCols(v1, skip);
 			v1.x = v1.boundsRect.right - 1;
 		} else {
 			skip = (v1.boundsRect.left -1) - rect.left;
@@ -996,7 +1127,17 @@ byte AkosRenderer::codec1(int xmoveCur, int ymoveCur) {
 
 	v1.destptr = (byte *)_out.getBasePtr(v1.x, v1.y);
 
-	codec1_genericDecode(v1);
+	if (useDecodedLimb) {
+		const byte *pixels = findDecodedLimb();
+		if (!pixels) {
+			byte *decoded = addDecodedLimb();
+			codec1_decodeLimb(decoded, v1);
+			pixels = decoded;
+		}
+		codec1_drawUnscaled(v1, pixels + skipColumns * _height);
+	} else {
+		codec1_genericDecode(v1);
+	}
 
 	return drawFlag;
 }
@@ -1095,10 +1236,6 @@ void AkosRenderer::akos16SetupBitReader(const byte *src) {
 		_akos16.bits >>= (n);
 
 
-void AkosRenderer::akos16SkipData(int32 numbytes) {
-	akos16DecodeLine(0, numbytes, 0);
-}
-
 void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	uint16 bits, tmp_bits;
 
@@ -1145,23 +1282,17 @@ void AkosRenderer::akos16DecodeLine(byte *buf, int32 numbytes, int32 dir) {
 	}
 }
 
-void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir,
+void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *pixels, int32 t_width, int32 t_height, int32 dir,
 		int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf) {
-	byte *tmp_buf = _akos16.buffer;
 	int maskpitch;
 	byte *maskptr;
 	const byte maskbit = revBitMask(maskLeft & 7);
 
 	if (dir < 0) {
 		dest -= (t_width - 1);
-		tmp_buf += (t_width - 1);
 	}
 
-	akos16SetupBitReader(src);
-
-	if (numskip_before != 0) {
-		akos16SkipData(numskip_before);
-	}
+	pixels += numskip_before;
 
 	maskpitch = _numStrips;
 
@@ -1170,14 +1301,17 @@ void AkosRenderer::akos16Decompress(byte *dest, int32 pitch, const byte *src, in
 	assert(t_height > 0);
 	assert(t_width > 0);
 	while (t_height--) {
-		akos16DecodeLine(tmp_buf, t_width, dir);
+		if (dir < 0) {
+			for (int32 i = 0; i < t_width; ++i)
+				_akos16.buffer[t_width - 1 - i] = pixels[i];
+		} else {
+			memcpy(_akos16.buffer, pixels, t_width);
+		}
 		bompApplyMask(_akos16.buffer, maskptr, maskbit, t_width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadow_mode, _shadow_table, _akos16.buffer, dest, t_width, transparency, HE7Check);
 
-		if (numskip_after != 0)	{
-			akos16SkipData(numskip_after);
-		}
+		pixels += t_width + numskip_after;
 		dest += pitch;
 		maskptr += maskpitch;
 	}
@@ -1290,7 +1424,15 @@ byte AkosRenderer::codec16(int xmoveCur, int ymoveCur) {
 
 	byte *dst = (byte *)_out.getBasePtr(width_unk, height_unk);
 
-	akos16Decompress(dst, _out.pitch, _srcptr, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
+	const byte *pixels = findDecodedLimb();
+	if (!pixels) {
+		byte *decoded = addDecodedLimb();
+		akos16SetupBitReader(_srcptr);
+		akos16DecodeLine(decoded, _width * _height, 1);
+		pixels = decoded;
+	}
+
+	akos16Decompress(dst, _out.pitch, pixels, cur_x, out_height, dir, numskip_before, numskip_after, transparency, clip.left, clip.top, _zbuf);
 	return 0;
 }
 
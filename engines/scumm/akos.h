@@ -23,6 +23,8 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/array.h"
+
 #include "scumm/base-costume.h"
 
 namespace Scumm {
@@ -85,6 +87,22 @@ protected:
 		byte buffer[336];
 	} _akos16;
 
+	// Limbs decoded to one color index per pixel, so that limbs which are
+	// drawn again (usually the next frame) don't have to be decoded again.
+	// Entries are keyed by the address of the limb in the costume resource,
+	// so they are dropped once the costume generation of the resource
+	// manager changes.
+	struct DecodedLimb {
+		const byte *src;
+		int width, height;
+		byte *pixels;
+		uint32 lastUsed;
+	};
+	Common::Array<DecodedLimb> _decodedLimbs;
+	uint32 _decodedLimbsSize;
+	uint32 _decodedLimbsClock;
+	uint32 _decodedLimbsGeneration;
+
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
 		_useBompPalette = false;
@@ -98,7 +116,11 @@ public:
 		rgbs = 0;
 		xmap = 0;
 		_actorHitMode = false;
+		_decodedLimbsSize = 0;
+		_decodedLimbsClock = 0;
+		_decodedLimbsGeneration = 0;
 	}
+	~AkosRenderer();
 
 	bool _actorHitMode;
 	int16 _actorHitX, _actorHitY;
@@ -111,15 +133,20 @@ public:
 protected:
 	byte drawLimb(const Actor *a, int limb);
 
+	void flushDecodedLimbs();
+	const byte *findDecodedLimb();
+	byte *addDecodedLimb();
+
 	byte codec1(int xmoveCur, int ymoveCur);
 	void codec1_genericDecode(Codec1 &v1);
+	void codec1_decodeLimb(byte *dst, const Codec1 &v1);
+	void codec1_drawUnscaled(Codec1 &v1, const byte *pixels);
 	byte codec5(int xmoveCur, int ymoveCur);
 	byte codec16(int xmoveCur, int ymoveCur);
 	byte codec32(int xmoveCur, int ymoveCur);
 	void akos16SetupBitReader(const byte *src);
-	void akos16SkipData(int32 numskip);
 	void akos16DecodeLine(byte *buf, int32 numbytes, int32 dir);
-	void akos16Decompress(byte *dest, int32 pitch, const byte *src, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
+	void akos16Decompress(byte *dest, int32 pitch, const byte *pixels, int32 t_width, int32 t_height, int32 dir, int32 numskip_before, int32 numskip_after, byte transparency, int maskLeft, int maskTop, int zBuf);
 
 	void markRectAsDirty(Common::Rect rect);
 };
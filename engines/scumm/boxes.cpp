@@ -571,7 +571,36 @@ bool ScummEngine::checkXYInBoxBounds(int boxnum, int x, int y) {
 	return true;
 }
 
+void ScummEngine::resetBoxCache() {
+	_boxCoordsCache.clear();
+	_boxCoordsCached.clear();
+	_nextBoxTable.clear();
+	_nextBoxTableSize = 0;
+}
+
 BoxCoords ScummEngine::getBoxCoordinates(int boxnum) {
+	// Boxes outside the regular range go through the decoder directly,
+	// since getBoxBaseAddr() applies some workarounds to those.
+	const int numOfBoxes = getNumBoxes();
+	if (boxnum < 0 || boxnum >= numOfBoxes)
+		return decodeBoxCoordinates(boxnum);
+
+	if (_boxCoordsCache.size() != (uint)numOfBoxes) {
+		_boxCoordsCache.resize(numOfBoxes);
+		_boxCoordsCached.resize(numOfBoxes);
+		for (int i = 0; i < numOfBoxes; i++)
+			_boxCoordsCached[i] = false;
+	}
+
+	if (!_boxCoordsCached[boxnum]) {
+		_boxCoordsCache[boxnum] = decodeBoxCoordinates(boxnum);
+		_boxCoordsCached[boxnum] = true;
+	}
+
+	return _boxCoordsCache[boxnum];
+}
+
+BoxCoords ScummEngine::decodeBoxCoordinates(int boxnum) {
 	BoxCoords tmp, *box = &tmp;
 	Box *bp = getBoxBaseAddr(boxnum);
 	assert(bp);
@@ -699,10 +728,7 @@ byte *ScummEngine::getBoxMatrixBaseAddr() {
  * If there is no connection -1 is return.
  */
 int ScummEngine::getNextBox(byte from, byte to) {
-	const byte *boxm;
-	byte i;
 	const int numOfBoxes = getNumBoxes();
-	int dest = -1;
 
 	if (from == to)
 		return to;
@@ -716,32 +742,68 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	assert(from < numOfBoxes);
 	assert(to < numOfBoxes);
 
-	boxm = getBoxMatrixBaseAddr();
+	if (_game.version <= 2 && _game.version != 0) {
+		// The v2 box matrix is a real matrix with numOfBoxes rows and columns.
+		// The first numOfBoxes bytes contain indices to the start of the corresponding
+		// row (although that seems unnecessary to me - the value is easily computable.
+		const byte *boxm = getBoxMatrixBaseAddr();
+		boxm += numOfBoxes + boxm[from];
+		return (int8)boxm[to];
+	}
+
+	// WORKAROUND: We have to add this special case to fix the scene in
+	// Indy3 where Indy meets Hitler in Berlin. See bug #770690 and also
+	// bug #774783, as well as the truncated box matrix workaround in
+	// calcNextBoxTable().
+	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
+		return 0;
+
+	if (_nextBoxTableSize != numOfBoxes)
+		calcNextBoxTable(numOfBoxes);
+
+	return (int8)_nextBoxTable[numOfBoxes * from + to];
+}
+
+/**
+ * Flattens the box matrix of the current room into a table with one entry
+ * for each (from, to) pair of boxes, holding the result getNextBox() has to
+ * return for it (0xFF if there is no connection). This replaces a scan of the
+ * compressed matrix (or, in v0, a complete shortest path computation) on
+ * every lookup.
+ */
+void ScummEngine::calcNextBoxTable(int num) {
+	_nextBoxTable.resize(num * num);
+	for (int i = 0; i < num * num; i++)
+		_nextBoxTable[i] = 0xFF;
+	_nextBoxTableSize = num;
 
 	if (_game.version == 0) {
 		// calculate shortest paths
-		byte *itineraryMatrix = (byte *)malloc(numOfBoxes * numOfBoxes);
-		calcItineraryMatrix(itineraryMatrix, numOfBoxes);
+		byte *itineraryMatrix = (byte *)malloc(num * num);
+		calcItineraryMatrix(itineraryMatrix, num);
 
-		dest = to;
-		do {
-			dest = itineraryMatrix[numOfBoxes * from + dest];
-		} while (dest != Actor::kInvalidBox && !areBoxesNeighbors(from, dest));
+		for (int from = 0; from < num; from++) {
+			for (int to = 0; to < num; to++) {
+				if (from == to)
+					continue;
 
-		if (dest == Actor::kInvalidBox)
-			dest = -1;
+				int dest = to;
+				do {
+					dest = itineraryMatrix[num * from + dest];
+				} while (dest != Actor::kInvalidBox && !areBoxesNeighbors(from, dest));
+
+				if (dest != Actor::kInvalidBox)
+					_nextBoxTable[num * from + to] = dest;
+			}
+		}
 
 		free(itineraryMatrix);
-		return dest;
-	} else if (_game.version <= 2) {
-		// The v2 box matrix is a real matrix with numOfBoxes rows and columns.
-		// The first numOfBoxes bytes contain indices to the start of the corresponding
-		// row (although that seems unnecessary to me - the value is easily computable.
-		boxm += numOfBoxes + boxm[from];
-		return (int8)boxm[to];
+		return;
 	}
 
-	// WORKAROUND #1: It seems that in some cases, the box matrix is corrupt
+	const byte *boxm = getBoxMatrixBaseAddr();
+
+	// WORKAROUND: It seems that in some cases, the box matrix is corrupt
 	// (more precisely, is too short) in the datafiles already. In
 	// particular this seems to be the case in room 46 of Indy3 EGA (see
 	// also bug #770690). This didn't cause problems in the original
@@ -751,33 +813,25 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	// since random data may follow after the resource in ScummVM.
 	//
 	// As a workaround, we add a check for the end of the box matrix
-	// resource, and abort the search once we reach the end.
+	// resource, and leave the remaining entries unconnected once we
+	// reach the end.
 	const byte *end = boxm + getResourceSize(rtMatrix, 1);
 
-	// WORKAROUND #2: In addition to the above, we have to add this special
-	// case to fix the scene in Indy3 where Indy meets Hitler in Berlin.
-	// See bug #770690 and also bug #774783.
-	if ((_game.id == GID_INDY3) && _roomResource == 46 && from == 1 && to == 0)
-		return 0;
-
-	// Skip up to the matrix data for box 'from'
-	for (i = 0; i < from && boxm < end; i++) {
-		while (boxm < end && *boxm != 0xFF)
+	// Each row of the compressed matrix consists of byte triples (see
+	// createBoxMatrix) and is terminated by 0xFF. Later triples take
+	// precedence over earlier ones covering the same box.
+	for (int from = 0; from < num && boxm < end; from++) {
+		byte *row = &_nextBoxTable[num * from];
+		while (boxm < end && boxm[0] != 0xFF) {
+			for (int to = boxm[0]; to <= boxm[1] && to < num; to++)
+				row[to] = boxm[2];
 			boxm += 3;
+		}
 		boxm++;
 	}
 
-	// Now search for the entry for box 'to'
-	while (boxm < end && boxm[0] != 0xFF) {
-		if (boxm[0] <= to && to <= boxm[1])
-			dest = (int8)boxm[2];
-		boxm += 3;
-	}
-
-	if (boxm >= end)
+	if (boxm > end)
 		debug(0, "The box matrix apparently is truncated (room %d)", _roomResource);
-
-	return dest;
 }
 
 /*
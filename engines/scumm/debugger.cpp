@@ -71,6 +71,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	registerCmd("actors",    WRAP_METHOD(ScummDebugger, Cmd_PrintActor));
 	registerCmd("box",       WRAP_METHOD(ScummDebugger, Cmd_PrintBox));
 	registerCmd("matrix",    WRAP_METHOD(ScummDebugger, Cmd_PrintBoxMatrix));
+	registerCmd("boxbench",  WRAP_METHOD(ScummDebugger, Cmd_BenchBoxes));
 	registerCmd("camera",    WRAP_METHOD(ScummDebugger, Cmd_Camera));
 	registerCmd("room",      WRAP_METHOD(ScummDebugger, Cmd_Room));
 	registerCmd("objects",   WRAP_METHOD(ScummDebugger, Cmd_PrintObjects));
@@ -582,6 +583,44 @@ bool ScummDebugger::Cmd_PrintBoxMatrix(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_BenchBoxes(int argc, const char **argv) {
+	const int num = _vm->getNumBoxes();
+	const int iterations = (argc > 1) ? atoi(argv[1]) : 100;
+
+	if (num == 0) {
+		debugPrintf("The current room has no walk boxes\n");
+		return true;
+	}
+
+	// Replay a walk request for every pair of boxes: follow the route hop by
+	// hop, and test the corners of each box on the way against the target box.
+	uint32 hops = 0, tests = 0;
+	const uint32 start = g_system->getMillis();
+	for (int n = 0; n < iterations; n++) {
+		for (int from = 0; from < num; from++) {
+			for (int to = 0; to < num; to++) {
+				int box = from;
+				for (int i = 0; i < num && box != to; i++) {
+					box = _vm->getNextBox(box, to);
+					if (box < 0)
+						break;
+					hops++;
+
+					BoxCoords coords = _vm->getBoxCoordinates(box);
+					_vm->checkXYInBoxBounds(to, coords.ul.x, coords.ul.y);
+					_vm->checkXYInBoxBounds(to, coords.lr.x, coords.lr.y);
+					tests += 2;
+				}
+			}
+		}
+	}
+	const uint32 elapsed = g_system->getMillis() - start;
+
+	debugPrintf("%d boxes, %d iterations: %d hops and %d box tests in %d ms\n",
+				num, iterations, hops, tests, elapsed);
+	return true;
+}
+
 void ScummDebugger::printBox(int box) {
 	if (box < 0 || box >= _vm->getNumBoxes()) {
 		debugPrintf("%d is not a valid box!\n", box);
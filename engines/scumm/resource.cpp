@@ -872,6 +872,7 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_costumeGeneration = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -899,6 +900,14 @@ void ResourceManager::nukeResource(ResType type, ResId idx) {
 		debugC(DEBUG_RESOURCE, "nukeResource(%s,%d)", nameOfResType(type), idx);
 		_allocatedSize -= _types[type][idx]._size;
 		_types[type][idx].nuke();
+
+		// The walkbox caches are derived from the box resources
+		if (type == rtMatrix)
+			_vm->resetBoxCache();
+
+		// Decoded AKOS limbs are looked up by their address in the costume
+		if (type == rtCostume)
+			++_costumeGeneration;
 	}
 }
 
@@ -175,6 +175,7 @@ protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
+	uint32 _costumeGeneration;
 
 public:
 	ResourceManager(ScummEngine *vm);
@@ -225,6 +226,12 @@ public:
 
 	void resourceStats();
 
+	/**
+	 * Return a counter which changes whenever a costume resource is freed,
+	 * so that data derived from costumes can tell when it is outdated.
+	 */
+	uint32 getCostumeGeneration() const { return _costumeGeneration; }
+
 //protected:
 	bool validateResource(const char *str, ResType type, ResId idx) const;
 protected:
@@ -304,6 +304,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_saveSound = 0;
 	memset(_extraBoxFlags, 0, sizeof(_extraBoxFlags));
 	memset(_scaleSlots, 0, sizeof(_scaleSlots));
+	_nextBoxTableSize = 0;
 	_charset = NULL;
 	_charsetColor = 0;
 	memset(_charsetColorMap, 0, sizeof(_charsetColorMap));
@@ -610,6 +611,7 @@ ScummEngine::~ScummEngine() {
 
 	delete _costumeLoader;
 	delete _costumeRenderer;
+	_costumeRenderer = NULL;
 
 	_textSurface.free();
 
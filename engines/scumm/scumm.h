@@ -25,6 +25,7 @@
 
 #include "engines/engine.h"
 
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
@@ -38,6 +39,7 @@
 #include "graphics/surface.h"
 #include "graphics/sjis.h"
 
+#include "scumm/boxes.h"
 #include "scumm/gfx.h"
 #include "scumm/detection.h"
 #include "scumm/script.h"
@@ -92,7 +94,6 @@ class Serializer;
 class Sound;
 
 struct Box;
-struct BoxCoords;
 struct FindObjectInRoom;
 
 // Use g_scumm from error() ONLY
@@ -1147,7 +1148,20 @@ public:
 	int getScale(int box, int x, int y);
 	int getScaleFromSlot(int slot, int x, int y);
 
+	void resetBoxCache();
+
 protected:
+	// Decoded walkbox coordinates and the flattened next-box table of the
+	// current box set. Both are filled lazily and dropped by resetBoxCache()
+	// whenever one of the rtMatrix resources is nuked.
+	Common::Array<BoxCoords> _boxCoordsCache;
+	Common::Array<bool> _boxCoordsCached;
+	Common::Array<byte> _nextBoxTable;
+	int _nextBoxTableSize;
+
+	BoxCoords decodeBoxCoordinates(int boxnum);
+	void calcNextBoxTable(int num);
+
 	// Scaling slots/items
 	struct ScaleSlot {
 		int x1, y1, scale1;
@@ -31,6 +31,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("continue",		WRAP_METHOD(Debugger, cmdExit));
 	registerCmd("scene",			WRAP_METHOD(Debugger, Cmd_Scene));
 	registerCmd("dirty_rects",	WRAP_METHOD(Debugger, Cmd_DirtyRects));
+	registerCmd("coroutines",	WRAP_METHOD(Debugger, Cmd_Coroutines));
 }
 
 static int strToInt(const char *s) {
@@ -126,4 +127,12 @@ bool Debugger::Cmd_DirtyRects(int argc, const char **argv) {
 	}
 }
 
+/**
+ * Shows the coroutine scheduler statistics and the active processes
+ */
+bool Debugger::Cmd_Coroutines(int argc, const char **argv) {
+	debugPrintf("%s", CoroScheduler.getStatsDescription().c_str());
+	return true;
+}
+
 } // End of namespace Tony
@@ -36,6 +36,7 @@ public:
 protected:
 	bool Cmd_Scene(int argc, const char **argv);
 	bool Cmd_DirtyRects(int argc, const char **argv);
+	bool Cmd_Coroutines(int argc, const char **argv);
 };
 
 } // End of namespace Tony
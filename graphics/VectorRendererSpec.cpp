@@ -435,6 +435,17 @@ precalcGradient(int h) {
 			_gradIndexes.push_back(i);
 		}
 	}
+
+	// Find the strip of every row once here, instead of searching for it
+	// each time a row is filled.
+	_gradRows.resize(h + 1);
+
+	int curGrad = 0;
+	for (int y = 0; y <= h; y++) {
+		while (_gradIndexes[curGrad + 1] <= y)
+			curGrad++;
+		_gradRows[y] = curGrad;
+	}
 }
 
 template<typename PixelType>
@@ -442,10 +453,10 @@ void VectorRendererSpec<PixelType>::
 gradientFill(PixelType *ptr, int width, int x, int y) {
 	bool ox = ((y & 1) == 1);
 	int stripSize;
-	int curGrad = 0;
 
-	while (_gradIndexes[curGrad + 1] <= y)
-		curGrad++;
+	// Tab bodies fill one row past the gradient height, it gets the color
+	// of the last row.
+	const int curGrad = _gradRows[MIN<int>(y, _gradRows.size() - 1)];
 
 	stripSize = _gradIndexes[curGrad + 1] - _gradIndexes[curGrad];
 
@@ -464,16 +475,21 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
+		// The pattern of the row only depends on the column parity
+		PixelType colors[2];
+		for (int j = 0; j < 2; j++) {
+			bool oy = (j == 1);
 
 			if ((ox && oy) ||
 				((grad == 2 || grad == 3) && ox && !oy) ||
 				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
+				colors[j] = _gradCache[curGrad + 1];
 			else
-				*ptr = _gradCache[curGrad];
+				colors[j] = _gradCache[curGrad];
 		}
+
+		for (int j = x; j < x + width; j++, ptr++)
+			*ptr = colors[j & 1];
 	}
 }
 
@@ -664,6 +680,62 @@ blendPixelPtr(PixelType *ptr, PixelType color, uint8 alpha) {
 	}
 }
 
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
+	// Same results as calling blendPixelPtr() for every pixel, but the source
+	// color and the format masks are split up only once per span.
+	if (alpha == 0xff) {
+		colorFill<PixelType>(first, last, color | _alphaMask);
+	} else if (alpha == 0) {
+		return;
+	} else if (sizeof(PixelType) == 4) {
+		const uint32 rMask = _redMask, gMask = _greenMask, bMask = _blueMask, aMask = _alphaMask;
+		const uint8 rShift = _format.rShift, gShift = _format.gShift, bShift = _format.bShift, aShift = _format.aShift;
+
+		const byte sR = (color & rMask) >> rShift;
+		const byte sG = (color & gMask) >> gShift;
+		const byte sB = (color & bMask) >> bShift;
+
+		for (; first != last; ++first) {
+			const uint32 idst = *first;
+
+			byte dR = (idst & rMask) >> rShift;
+			byte dG = (idst & gMask) >> gShift;
+			byte dB = (idst & bMask) >> bShift;
+			byte dA = (idst & aMask) >> aShift;
+
+			dR += ((sR - dR) * alpha) >> 8;
+			dG += ((sG - dG) * alpha) >> 8;
+			dB += ((sB - dB) * alpha) >> 8;
+			dA += ((0xff - dA) * alpha) >> 8;
+
+			*first = ((dR << rShift) & rMask)
+			       | ((dG << gShift) & gMask)
+			       | ((dB << bShift) & bMask)
+			       | ((dA << aShift) & aMask);
+		}
+	} else if (sizeof(PixelType) == 2) {
+		const int rMask = _redMask, gMask = _greenMask, bMask = _blueMask, aMask = _alphaMask;
+
+		const int sR = color & rMask;
+		const int sG = color & gMask;
+		const int sB = color & bMask;
+
+		for (; first != last; ++first) {
+			const int idst = *first;
+
+			*first = (PixelType)(
+				(rMask & ((idst & rMask) + (((sR - (idst & rMask)) * alpha) >> 8))) |
+				(gMask & ((idst & gMask) + (((sG - (idst & gMask)) * alpha) >> 8))) |
+				(bMask & ((idst & bMask) + (((sB - (idst & bMask)) * alpha) >> 8))) |
+				(aMask & ((idst & aMask) + (((aMask - (idst & aMask)) * alpha) >> 8))));
+		}
+	} else {
+		error("Unsupported BPP format: %u", (uint)sizeof(PixelType));
+	}
+}
+
 template<typename PixelType>
 inline void VectorRendererSpec<PixelType>::
 blendPixelDestAlphaPtr(PixelType *ptr, PixelType color, uint8 alpha) {
@@ -223,9 +223,7 @@ protected:
 	 * @param color Color of the pixel
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
-	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
-		while (first != last) blendPixelPtr(first++, color, alpha);
-	}
+	void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha);
 
 	void darkenFill(PixelType *first, PixelType *last);
 
@@ -242,6 +240,7 @@ protected:
 
 	Common::Array<PixelType> _gradCache;
 	Common::Array<int> _gradIndexes;
+	Common::Array<int> _gradRows; /**< Index into _gradCache of the strip containing each row */
 
 	PixelType _bevelColor;
 	PixelType _bitmapAlphaColor;
@@ -34,6 +34,7 @@
 #include "common/singleton.h"
 #include "common/stream.h"
 #include "common/hashmap.h"
+#include "common/array.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -137,6 +138,25 @@ private:
 	bool _allowLateCaching;
 	void assureCached(uint32 chr) const;
 
+	// The glyph images are packed row by row into shared atlas pages, so
+	// that caching a glyph does not need an allocation of its own and the
+	// glyphs of a font end up close to each other in memory.
+	enum {
+		kAtlasPageSize = 256
+	};
+
+	typedef Common::Array<Surface *> AtlasPageList;
+	mutable AtlasPageList _atlasPages;
+	mutable Surface *_atlasPage;
+	mutable int _atlasX, _atlasY, _atlasRowHeight;
+	void allocateGlyphImage(Surface &image, int w, int h) const;
+
+	// Kerning offsets indexed by the character pair, so that FreeType is
+	// only asked once per pair.
+	typedef Common::HashMap<uint32, int> KerningCache;
+	mutable KerningCache _kerning;
+	int computeKerningOffset(uint32 left, uint32 right) const;
+
 	FT_Int32 _loadFlags;
 	FT_Render_Mode _renderMode;
 	bool _hasKerning;
@@ -144,8 +164,9 @@ private:
 
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
-      _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
-      _hasKerning(false), _allowLateCaching(false) {
+      _descent(0), _glyphs(), _allowLateCaching(false), _atlasPages(), _atlasPage(0), _atlasX(0), _atlasY(0),
+      _atlasRowHeight(0), _kerning(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
+      _hasKerning(false) {
 }
 
 TTFFont::~TTFFont() {
@@ -155,8 +176,12 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
+		for (AtlasPageList::iterator i = _atlasPages.begin(); i != _atlasPages.end(); ++i) {
+			(*i)->free();
+			delete *i;
+		}
+		_atlasPages.clear();
+		_atlasPage = 0;
 
 		_initialized = false;
 	}
@@ -283,6 +308,22 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
+	// Characters outside of the Basic Multilingual Plane do not fit into the
+	// cache key, they are rare enough to always be looked up.
+	if (left > 0xFFFF || right > 0xFFFF)
+		return computeKerningOffset(left, right);
+
+	const uint32 pair = (left << 16) | right;
+	KerningCache::const_iterator kerningEntry = _kerning.find(pair);
+	if (kerningEntry != _kerning.end())
+		return kerningEntry->_value;
+
+	const int offset = computeKerningOffset(left, right);
+	_kerning[pair] = offset;
+	return offset;
+}
+
+int TTFFont::computeKerningOffset(uint32 left, uint32 right) const {
 	assureCached(left);
 	assureCached(right);
 
@@ -460,7 +501,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	glyph.advance = ftCeil26_6(_face->glyph->advance.x);
 
 	const FT_Bitmap &bitmap = _face->glyph->bitmap;
-	glyph.image.create(bitmap.width, bitmap.rows, PixelFormat::createFormatCLUT8());
+	if (bitmap.pixel_mode != FT_PIXEL_MODE_MONO && bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
+		return false;
+	}
+
+	allocateGlyphImage(glyph.image, bitmap.width, bitmap.rows);
 
 	const uint8 *src = bitmap.buffer;
 	int srcPitch = bitmap.pitch;
@@ -469,8 +515,9 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
+	// The atlas pages are cleared on allocation, so only the set pixels
+	// need to be written.
 	uint8 *dst = (uint8 *)glyph.image.getPixels();
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
 
 	switch (bitmap.pixel_mode) {
 	case FT_PIXEL_MODE_MONO:
@@ -483,12 +530,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					dst[x] = 255;
 
 				mask <<= 1;
-				++dst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
 		break;
@@ -502,14 +549,52 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		break;
 
 	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
-		glyph.image.free();
-		return false;
+		break;
 	}
 
 	return true;
 }
 
+void TTFFont::allocateGlyphImage(Surface &image, int w, int h) const {
+	const PixelFormat format = PixelFormat::createFormatCLUT8();
+
+	if (!w || !h) {
+		image.init(w, h, w, 0, format);
+		return;
+	}
+
+	if (w > kAtlasPageSize || h > kAtlasPageSize) {
+		// Glyphs too large for a page get a page of their own, which is
+		// never used for anything else.
+		Surface *page = new Surface();
+		page->create(w, h, format);
+		memset(page->getPixels(), 0, page->h * page->pitch);
+		_atlasPages.push_back(page);
+		image.init(w, h, page->pitch, page->getPixels(), format);
+		return;
+	}
+
+	if (_atlasX + w > kAtlasPageSize) {
+		_atlasX = 0;
+		_atlasY += _atlasRowHeight;
+		_atlasRowHeight = 0;
+	}
+
+	if (!_atlasPage || _atlasY + h > kAtlasPageSize) {
+		_atlasPage = new Surface();
+		_atlasPage->create(kAtlasPageSize, kAtlasPageSize, format);
+		memset(_atlasPage->getPixels(), 0, _atlasPage->h * _atlasPage->pitch);
+		_atlasPages.push_back(_atlasPage);
+
+		_atlasX = _atlasY = _atlasRowHeight = 0;
+	}
+
+	image.init(w, h, _atlasPage->pitch, _atlasPage->getBasePtr(_atlasX, _atlasY), format);
+
+	_atlasX += w;
+	_atlasRowHeight = MAX(_atlasRowHeight, h);
+}
+
 void TTFFont::assureCached(uint32 chr) const {
 	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
 		return;
@@ -438,16 +438,41 @@ Graphics::Surface *Surface::convertTo(const PixelFormat &dstFormat, const byte *
 		error("Surface::convertTo(): Can only convert to 2Bpp and 4Bpp");
 
 	surface->create(w, h, dstFormat);
+	convertInto(*surface, palette);
+
+	return surface;
+}
+
+void Surface::convertInto(Surface &dst, const byte *palette) const {
+	assert(pixels);
+	assert(dst.pixels);
+
+	const PixelFormat &dstFormat = dst.format;
+	const int width = MIN(w, dst.w);
+	const int height = MIN(h, dst.h);
+
+	// If the target format is the same, just copy
+	if (format == dstFormat) {
+		for (int y = 0; y < height; y++)
+			memcpy(dst.getBasePtr(0, y), getBasePtr(0, y), width * format.bytesPerPixel);
+		return;
+	}
+
+	if (format.bytesPerPixel == 0 || format.bytesPerPixel > 4)
+		error("Surface::convertInto(): Can only convert from 1Bpp, 2Bpp, 3Bpp, and 4Bpp");
+
+	if (dstFormat.bytesPerPixel != 2 && dstFormat.bytesPerPixel != 4)
+		error("Surface::convertInto(): Can only convert to 2Bpp and 4Bpp");
 
 	if (format.bytesPerPixel == 1) {
 		// Converting from paletted to high color
 		assert(palette);
 
-		for (int y = 0; y < h; y++) {
+		for (int y = 0; y < height; y++) {
 			const byte *srcRow = (const byte *)getBasePtr(0, y);
-			byte *dstRow = (byte *)surface->getBasePtr(0, y);
+			byte *dstRow = (byte *)dst.getBasePtr(0, y);
 
-			for (int x = 0; x < w; x++) {
+			for (int x = 0; x < width; x++) {
 				byte index = *srcRow++;
 				byte r = palette[index * 3];
 				byte g = palette[index * 3 + 1];
@@ -465,11 +490,11 @@ Graphics::Surface *Surface::convertTo(const PixelFormat &dstFormat, const byte *
 		}
 	} else {
 		// Converting from high color to high color
-		for (int y = 0; y < h; y++) {
+		for (int y = 0; y < height; y++) {
 			const byte *srcRow = (const byte *)getBasePtr(0, y);
-			byte *dstRow = (byte *)surface->getBasePtr(0, y);
+			byte *dstRow = (byte *)dst.getBasePtr(0, y);
 
-			for (int x = 0; x < w; x++) {
+			for (int x = 0; x < width; x++) {
 				uint32 srcColor;
 				if (format.bytesPerPixel == 2)
 					srcColor = READ_UINT16(srcRow);
@@ -494,8 +519,6 @@ Graphics::Surface *Surface::convertTo(const PixelFormat &dstFormat, const byte *
 			}
 		}
 	}
-
-	return surface;
 }
 
 } // End of namespace Graphics
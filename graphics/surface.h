@@ -258,6 +258,19 @@ public:
 	 */
 	Graphics::Surface *convertTo(const PixelFormat &dstFormat, const byte *palette = 0) const;
 
+	/**
+	 * Convert the data into an already allocated surface.
+	 *
+	 * The data is converted to the pixel format of the destination, which
+	 * may also be a sub-area of another surface. Only the part that fits
+	 * into both surfaces is converted. Unlike convertTo this does not
+	 * allocate anything.
+	 *
+	 * @param dst       The surface to write to
+	 * @param palette   The palette (in RGB888), if the source format has a Bpp of 1
+	 */
+	void convertInto(Surface &dst, const byte *palette = 0) const;
+
 	/**
 	 * Draw a line.
 	 *
@@ -524,8 +524,9 @@ bool EventRecorder::grabScreenAndComputeMD5(Graphics::Surface &screen, uint8 md5
 		warning("Can't save screenshot");
 		return false;
 	}
-	Common::MemoryReadStream bitmapStream((const byte*)screen.getPixels(), screen.w * screen.h * screen.format.bytesPerPixel);
-	computeStreamMD5(bitmapStream, md5);
+	Common::MD5 hash;
+	hash.update(screen.getPixels(), screen.w * screen.h * screen.format.bytesPerPixel);
+	hash.finish(md5);
 	return true;
 }
 
@@ -84,6 +84,16 @@ struct WidgetDrawData {
 
 	bool _buffer;
 
+	/** Whether the rendered image of this item may be reused by the widget cache */
+	bool _cacheable;
+
+	/**
+	 * The colors left set in the renderer after drawing the steps. When the
+	 * cached image is used instead, these are set, so that the next item
+	 * which relies on them is drawn the same.
+	 */
+	Graphics::DrawStep _lastColors;
+
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -93,6 +103,13 @@ struct WidgetDrawData {
 	 * value will be added when restoring the background of the widget.
 	 */
 	void calcBackgroundOffset();
+
+	/**
+	 * Checks whether the draw steps set all the colors they use themselves.
+	 * Otherwise their output would depend on the colors left in the renderer
+	 * by whatever was drawn before, and the widget cache cannot be used.
+	 */
+	void calcCacheable();
 };
 
 class ThemeItem {
@@ -233,11 +250,8 @@ void ThemeItemDrawData::drawSelf(bool draw, bool restore) {
 	if (restore)
 		_engine->restoreBackground(extendedRect);
 
-	if (draw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = _data->_steps.begin(); step != _data->_steps.end(); ++step)
-			_engine->renderer()->drawStep(_area, *step, _dynamicData);
-	}
+	if (draw)
+		_engine->drawSteps(_data, _area, extendedRect, _dynamicData);
 
 	_engine->addDirtyRect(extendedRect);
 }
@@ -277,7 +291,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_buffering(false), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(0) {
+	_cursor(0), _widgetCacheSize(0), _widgetCacheHits(0), _drawStepsExecuted(0) {
 
 	_system = g_system;
 	_parser = new ThemeParser(this);
@@ -309,6 +323,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 
 	_graphicsMode = mode;
 	_themeArchive = 0;
+	_themeWidth = _themeHeight = 0;
 	_initOk = false;
 
 	// We prefer files in archive bundles over the common search paths.
@@ -321,6 +336,7 @@ ThemeEngine::~ThemeEngine() {
 	_screen.free();
 	_backBuffer.free();
 
+	clearWidgetCache();
 	unloadTheme();
 
 	// Release all graphics surfaces
@@ -388,6 +404,7 @@ const char *ThemeEngine::findModeConfigName(GraphicsMode mode) {
 bool ThemeEngine::init() {
 	// reset everything and reload the graphics
 	_initOk = false;
+	const Graphics::PixelFormat oldOverlayFormat = _overlayFormat;
 	_overlayFormat = _system->getOverlayFormat();
 	setGraphicsMode(_graphicsMode);
 
@@ -433,7 +450,15 @@ bool ThemeEngine::init() {
 	// We pass the theme file here by default, so the user will
 	// have a descriptive error message. The only exception will
 	// be the builtin theme which has no filename.
-	loadTheme(_themeFile.empty() ? _themeId : _themeFile);
+	// The parsed theme only depends on the overlay size and format, so it
+	// is kept when the backend reinitialized the overlay without changing
+	// those, e.g. when switching the graphics mode.
+	if (!_themeOk || _overlayFormat != oldOverlayFormat
+	    || _themeWidth != _system->getOverlayWidth() || _themeHeight != _system->getOverlayHeight()) {
+		loadTheme(_themeFile.empty() ? _themeId : _themeFile);
+		_themeWidth = _system->getOverlayWidth();
+		_themeHeight = _system->getOverlayHeight();
+	}
 
 	return ready();
 }
@@ -529,6 +554,9 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	// list. Clearing it avoids invalid overlay writes when the backend
 	// resizes the overlay.
 	_dirtyScreen.clear();
+
+	// The cached images have the old size and format.
+	clearWidgetCache();
 }
 
 void WidgetDrawData::calcBackgroundOffset() {
@@ -545,11 +573,133 @@ void WidgetDrawData::calcBackgroundOffset() {
 	_backgroundOffset = maxShadow;
 }
 
+void WidgetDrawData::calcCacheable() {
+	bool fgColor = false, bgColor = false, gradColors = false, bevelColor = false;
+
+	memset(&_lastColors, 0, sizeof(_lastColors));
+
+	_cacheable = true;
+	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
+	        step != _steps.end(); ++step) {
+		// Colors set by a step stay active for the following ones.
+		fgColor |= step->fgColor.set;
+		bgColor |= step->bgColor.set;
+		gradColors |= step->gradColor1.set && step->gradColor2.set;
+		bevelColor |= step->bevelColor.set;
+
+		if (step->fgColor.set)
+			_lastColors.fgColor = step->fgColor;
+		if (step->bgColor.set)
+			_lastColors.bgColor = step->bgColor;
+		if (step->gradColor1.set && step->gradColor2.set) {
+			_lastColors.gradColor1 = step->gradColor1;
+			_lastColors.gradColor2 = step->gradColor2;
+		}
+		if (step->bevelColor.set)
+			_lastColors.bevelColor = step->bevelColor;
+
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_VOID ||
+		    step->drawingCall == &Graphics::VectorRenderer::drawCallback_BITMAP)
+			continue;
+
+		if (!fgColor ||
+		    (step->fillMode == Graphics::VectorRenderer::kFillBackground && !bgColor) ||
+		    (step->fillMode == Graphics::VectorRenderer::kFillGradient && !gradColors) ||
+		    (step->bevel && !bevelColor)) {
+			_cacheable = false;
+			return;
+		}
+	}
+}
+
 void ThemeEngine::restoreBackground(Common::Rect r) {
 	r.clip(_screen.w, _screen.h);
 	_vectorRenderer->blitSurface(&_backBuffer, r);
 }
 
+static bool compareSurfaceArea(const Graphics::Surface &surface, const Common::Rect &r, const Graphics::Surface &contents) {
+	const uint lineSize = r.width() * surface.format.bytesPerPixel;
+
+	for (int y = 0; y < r.height(); ++y) {
+		if (memcmp(surface.getBasePtr(r.left, r.top + y), contents.getBasePtr(0, y), lineSize))
+			return false;
+	}
+
+	return true;
+}
+
+void ThemeEngine::drawSteps(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &extendedArea, uint32 dynamicData) {
+	Graphics::Surface *surface = _vectorRenderer->getSurface();
+
+	Common::Rect r = extendedArea;
+	r.clip(surface->w, surface->h);
+
+	// Drawing the steps blends with what is already on the surface, so the
+	// cached image is only reused when the background matches exactly.
+	const uint32 entrySize = 2 * r.width() * r.height() * surface->format.bytesPerPixel;
+	const uint32 maxCacheSize = 4 * _screen.pitch * _screen.h;
+
+	WidgetCacheEntry *entry = 0;
+	if (data->_cacheable && !r.isEmpty() && entrySize <= maxCacheSize) {
+		WidgetCacheKey key;
+		key.data = data;
+		key.area = area;
+		key.dynamicData = dynamicData;
+		key.shadows = _vectorRenderer->shadowsEnabled();
+
+		WidgetCacheMap::iterator i = _widgetCache.find(key);
+		if (i != _widgetCache.end()) {
+			entry = i->_value;
+
+			if (compareSurfaceArea(*surface, r, entry->background)) {
+				surface->copyRectToSurface(entry->image.getPixels(), entry->image.pitch, r.left, r.top, r.width(), r.height());
+				_vectorRenderer->setStepColors(data->_lastColors);
+				++_widgetCacheHits;
+				return;
+			}
+		} else {
+			while (_widgetCacheSize + entrySize > maxCacheSize) {
+				WidgetCacheMap::iterator oldest = _widgetCache.find(_widgetCacheOrder.front());
+				_widgetCacheSize -= 2 * oldest->_value->image.pitch * oldest->_value->image.h;
+				oldest->_value->background.free();
+				oldest->_value->image.free();
+				delete oldest->_value;
+				_widgetCache.erase(oldest);
+				_widgetCacheOrder.pop_front();
+			}
+
+			entry = new WidgetCacheEntry();
+			entry->background.create(r.width(), r.height(), surface->format);
+			entry->image.create(r.width(), r.height(), surface->format);
+			_widgetCache[key] = entry;
+			_widgetCacheOrder.push_back(key);
+			_widgetCacheSize += entrySize;
+		}
+
+		entry->background.copyRectToSurface(surface->getBasePtr(r.left, r.top), surface->pitch, 0, 0, r.width(), r.height());
+	}
+
+	Common::List<Graphics::DrawStep>::const_iterator step;
+	for (step = data->_steps.begin(); step != data->_steps.end(); ++step)
+		_vectorRenderer->drawStep(area, *step, dynamicData);
+	_drawStepsExecuted += data->_steps.size();
+
+	if (entry)
+		entry->image.copyRectToSurface(surface->getBasePtr(r.left, r.top), surface->pitch, 0, 0, r.width(), r.height());
+}
+
+void ThemeEngine::clearWidgetCache() {
+	for (WidgetCacheMap::iterator i = _widgetCache.begin(); i != _widgetCache.end(); ++i) {
+		i->_value->background.free();
+		i->_value->image.free();
+		delete i->_value;
+	}
+
+	_widgetCache.clear();
+	_widgetCacheOrder.clear();
+	_widgetCacheSize = 0;
+}
+
 
 
 /**********************************************************
@@ -684,6 +834,7 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
  * Theme XML loading
  *********************************************************/
 void ThemeEngine::loadTheme(const Common::String &themeId) {
+	const uint32 startTime = _system->getMillis();
 	unloadTheme();
 
 	debug(6, "Loading theme %s", themeId.c_str());
@@ -705,14 +856,20 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 			warning("Missing data asset: '%s'", kDrawDataDefaults[i].name);
 		} else {
 			_widgets[i]->calcBackgroundOffset();
+			_widgets[i]->calcCacheable();
 		}
 	}
+
+	debug(6, "Loaded theme %s in %u ms", themeId.c_str(), _system->getMillis() - startTime);
 }
 
 void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	// The cache is keyed by the DrawData items deleted below.
+	clearWidgetCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -1222,6 +1379,8 @@ void ThemeEngine::debugWidgetPosition(const char *name, const Common::Rect &r) {
  * Screen/overlay management
  *********************************************************/
 void ThemeEngine::updateScreen(bool render) {
+	const bool drawQueued = !_bufferQueue.empty() || !_screenQueue.empty();
+
 	if (!_bufferQueue.empty()) {
 		_vectorRenderer->setSurface(&_backBuffer);
 
@@ -1246,6 +1405,9 @@ void ThemeEngine::updateScreen(bool render) {
 		_screenQueue.clear();
 	}
 
+	if (drawQueued)
+		debug(9, "ThemeEngine: %u widget cache hits, %u draw steps executed", _widgetCacheHits, _drawStepsExecuted);
+
 	if (render)
 		renderDirtyScreen();
 }
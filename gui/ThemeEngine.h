@@ -523,6 +523,19 @@ public:
 	 */
 	void restoreBackground(Common::Rect r);
 
+	/**
+	 * Executes the draw steps of a DrawData item on the active surface of
+	 * the renderer. If the same item was drawn at the same place over the
+	 * same background before, the rendered image is copied from the widget
+	 * cache instead.
+	 *
+	 * @param data The DrawData item to draw.
+	 * @param area Area to draw the item in.
+	 * @param extendedArea Area the steps might touch, including shadows.
+	 * @param dynamicData Dynamic data passed to the draw steps.
+	 */
+	void drawSteps(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &extendedArea, uint32 dynamicData);
+
 	const Common::String &getThemeName() const { return _themeName; }
 	const Common::String &getThemeId() const { return _themeId; }
 	int getGraphicsMode() const { return _graphicsMode; }
@@ -673,6 +686,43 @@ protected:
 	/** Queue with all the drawing that must be done to the screen */
 	Common::List<ThemeItem *> _screenQueue;
 
+	/** Identifies a DrawData item drawn at a certain place. */
+	struct WidgetCacheKey {
+		const WidgetDrawData *data;
+		Common::Rect area;
+		uint32 dynamicData;
+		bool shadows;
+
+		bool operator==(const WidgetCacheKey &key) const {
+			return data == key.data && area == key.area && dynamicData == key.dynamicData && shadows == key.shadows;
+		}
+	};
+
+	struct WidgetCacheKey_Hash {
+		uint operator()(const WidgetCacheKey &key) const {
+			return (uint)(size_t)key.data ^ (key.area.left << 20) ^ (key.area.top << 8) ^ (key.area.width() << 14) ^ key.area.height() ^ key.dynamicData ^ key.shadows;
+		}
+	};
+
+	/** The screen contents before and after drawing a DrawData item. */
+	struct WidgetCacheEntry {
+		Graphics::Surface background;
+		Graphics::Surface image;
+	};
+
+	typedef Common::HashMap<WidgetCacheKey, WidgetCacheEntry *, WidgetCacheKey_Hash> WidgetCacheMap;
+
+	/** Rendered DrawData items, the oldest are dropped first. */
+	WidgetCacheMap _widgetCache;
+	Common::List<WidgetCacheKey> _widgetCacheOrder;
+	uint32 _widgetCacheSize;
+
+	/** Statistics for the debug output. */
+	uint32 _widgetCacheHits;
+	uint32 _drawStepsExecuted;
+
+	void clearWidgetCache();
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
@@ -680,6 +730,7 @@ protected:
 	Common::String _themeName; ///< Name of the currently loaded theme
 	Common::String _themeId;
 	Common::String _themeFile;
+	int16 _themeWidth, _themeHeight; ///< Overlay size the theme was parsed for
 	Common::Archive *_themeArchive;
 	Common::SearchSet _themeFiles;
 
@@ -21,8 +21,11 @@
  */
 
 #include "gui/saveload-dialog.h"
+#include "common/algorithm.h"
 #include "common/translation.h"
 #include "common/config-manager.h"
+#include "common/savefile.h"
+#include "common/system.h"
 
 #include "gui/message.h"
 #include "gui/gui-manager.h"
@@ -70,6 +73,7 @@ SaveLoadChooserDialog::SaveLoadChooserDialog(const Common::String &dialogName, c
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(0), _gridButton(0)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
+	, _listedMetaEngine(0), _listedChangeCounter(0)
 	{
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	addChooserButtons();
@@ -82,6 +86,7 @@ SaveLoadChooserDialog::SaveLoadChooserDialog(int x, int y, int w, int h, const b
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	, _listButton(0), _gridButton(0)
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
+	, _listedMetaEngine(0), _listedChangeCounter(0)
 	{
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	addChooserButtons();
@@ -108,6 +113,29 @@ int SaveLoadChooserDialog::run(const Common::String &target, const MetaEngine *m
 	return runIntern();
 }
 
+bool SaveLoadChooserDialog::listSaves(SaveStateList &saveList) {
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	const uint32 changeCounter = saveFileMan->getChangeCounter();
+
+	// Savefiles added or removed outside of ScummVM only show up in the list
+	// of files. Existing savefiles modified outside of ScummVM are missed.
+	Common::StringArray files = saveFileMan->listSavefiles("*");
+	Common::sort(files.begin(), files.end());
+
+	const bool changed = _target != _listedTarget || _metaEngine != _listedMetaEngine
+	                     || changeCounter != _listedChangeCounter || files != _listedFiles;
+	if (changed) {
+		_listedSaves = _metaEngine->listSaves(_target.c_str());
+		_listedTarget = _target;
+		_listedMetaEngine = _metaEngine;
+		_listedChangeCounter = changeCounter;
+		_listedFiles = files;
+	}
+
+	saveList = _listedSaves;
+	return changed;
+}
+
 void SaveLoadChooserDialog::handleCommand(CommandSender *sender, uint32 cmd, uint32 data) {
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	switch (cmd) {
@@ -463,7 +491,7 @@ void SaveLoadChooserSimple::close() {
 }
 
 void SaveLoadChooserSimple::updateSaveList() {
-	_saveList = _metaEngine->listSaves(_target.c_str());
+	listSaves(_saveList);
 
 	int curSlot = 0;
 	int saveSlot = 0;
@@ -536,6 +564,16 @@ enum {
 	kNewSaveCmd = 'SAVE'
 };
 
+enum {
+	// Upper bound (in milliseconds) we want to spend querying save meta
+	// infos in handleTickle.
+	kMaxSaveInfoTime = 20,
+
+	// Number of queried meta infos kept around, so that flipping back to a
+	// page does not require loading its thumbnails again.
+	kMaxSaveInfos = 64
+};
+
 SaveLoadChooserGrid::SaveLoadChooserGrid(const Common::String &title, bool saveMode)
 	: SaveLoadChooserDialog("SaveLoadChooser", saveMode), _lines(0), _columns(0), _entriesPerPage(0),
 	_curPage(0), _newSaveContainer(0), _nextFreeSaveSlot(0), _buttons() {
@@ -622,7 +660,10 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
-	_saveList = _metaEngine->listSaves(_target.c_str());
+	// The meta infos of the last time the dialog was shown are only kept
+	// when the saves did not change in the meantime.
+	if (listSaves(_saveList))
+		clearSaveInfos();
 	_resultString.clear();
 
 	// Load information to restore the last page the user had open.
@@ -851,54 +892,17 @@ void SaveLoadChooserGrid::hideButtons() {
 void SaveLoadChooserGrid::updateSaves() {
 	hideButtons();
 
+	// Slots whose meta infos are not known yet only show the description
+	// from the save list for now. handleTickle fills in the rest.
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
-
-		SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
-
-		Common::String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
-
-		if (_saveDateSupport) {
-			const Common::String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += "\n";
-				tooltip +=  _("Date: ") + saveDate;
-			}
 
-			const Common::String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Time: ") + saveTime;
-			}
-		}
-
-		if (_playTimeSupport) {
-			const Common::String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Playtime: ") + playTime;
-			}
-		}
-
-		curButton.button->setTooltip(tooltip);
-
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		if (_saveMode && desc.getWriteProtectedFlag()) {
-			curButton.button->setEnabled(false);
-		} else {
-			curButton.button->setEnabled(true);
-		}
+		SaveInfoMap::const_iterator info = _saveInfos.find(_saveList[i].getSaveSlot());
+		if (info != _saveInfos.end())
+			updateSaveButton(curButton, info->_value, true);
+		else
+			updateSaveButton(curButton, _saveList[i], false);
 	}
 
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
@@ -915,6 +919,91 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSaveButton(SlotButton &button, const SaveStateDescriptor &desc, bool hasMetaInfo) {
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		button.button->setGfx(thumbnail);
+	} else {
+		button.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	button.description->setLabel(Common::String::format("%d. %s", desc.getSaveSlot(), desc.getDescription().c_str()));
+
+	Common::String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += "\n";
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	button.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected. Until
+	// the meta infos are loaded we do not know yet, so keep it disabled.
+	// TODO: Maybe we should not display it at all then?
+	if (_saveMode && (!hasMetaInfo || desc.getWriteProtectedFlag())) {
+		button.button->setEnabled(false);
+	} else {
+		button.button->setEnabled(true);
+	}
+}
+
+void SaveLoadChooserGrid::handleTickle() {
+	const uint32 start = g_system->getMillis();
+
+	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
+		const int saveSlot = _saveList[i].getSaveSlot();
+		if (_saveInfos.contains(saveSlot))
+			continue;
+
+		if (g_system->getMillis() - start >= kMaxSaveInfoTime)
+			break;
+
+		const SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+		addSaveInfo(desc);
+
+		SlotButton &curButton = _buttons[curNum];
+		updateSaveButton(curButton, desc, true);
+		curButton.container->draw();
+	}
+
+	SaveLoadChooserDialog::handleTickle();
+}
+
+void SaveLoadChooserGrid::addSaveInfo(const SaveStateDescriptor &desc) {
+	// Drop the infos queried first. Since only the slots of the current page
+	// are queried, those belong to pages no longer shown.
+	while (_saveInfos.size() >= MAX<uint>(kMaxSaveInfos, _entriesPerPage)) {
+		_saveInfos.erase(_saveInfoOrder.front());
+		_saveInfoOrder.pop_front();
+	}
+
+	_saveInfos[desc.getSaveSlot()] = desc;
+	_saveInfoOrder.push_back(desc.getSaveSlot());
+}
+
+void SaveLoadChooserGrid::clearSaveInfos() {
+	_saveInfos.clear();
+	_saveInfoOrder.clear();
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
@@ -28,6 +28,10 @@
 
 #include "engines/metaengine.h"
 
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/str-array.h"
+
 namespace GUI {
 
 #define kSwitchSaveLoadDialog -2
@@ -70,6 +74,17 @@ public:
 protected:
 	virtual int runIntern() = 0;
 
+	/**
+	 * Lists the saves of the current target. As long as neither the target
+	 * nor any savefile changed since the last call, the list of that call
+	 * is returned again instead of reading every savefile again.
+	 *
+	 * @param saveList	list to fill with the saves
+	 * @return true if the saves were listed anew, meaning that any other
+	 *         information kept about them is outdated
+	 */
+	bool listSaves(SaveStateList &saveList);
+
 	const bool				_saveMode;
 	const MetaEngine		*_metaEngine;
 	bool					_delSupport;
@@ -86,6 +101,13 @@ protected:
 	void addChooserButtons();
 	ButtonWidget *createSwitchButton(const Common::String &name, const char *desc, const char *tooltip, const char *image, uint32 cmd = 0);
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
+
+private:
+	SaveStateList			_listedSaves;
+	Common::String			_listedTarget;
+	const MetaEngine		*_listedMetaEngine;
+	uint32					_listedChangeCounter;
+	Common::StringArray		_listedFiles;
 };
 
 class SaveLoadChooserSimple : public SaveLoadChooserDialog {
@@ -164,6 +186,7 @@ public:
 protected:
 	virtual void handleCommand(CommandSender *sender, uint32 cmd, uint32 data);
 	virtual void handleMouseWheel(int x, int y, int direction);
+	virtual void handleTickle();
 private:
 	virtual int runIntern();
 
@@ -201,6 +224,19 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+	void updateSaveButton(SlotButton &button, const SaveStateDescriptor &desc, bool hasMetaInfo);
+
+	/**
+	 * Meta infos of the saves already queried. Only the visible slots are
+	 * queried, a few per tickle, so that the dialog stays responsive for
+	 * games with many saves. They are kept when the dialog is closed and
+	 * reused when it is opened again, unless listSaves() reports changes.
+	 */
+	typedef Common::HashMap<int, SaveStateDescriptor> SaveInfoMap;
+	SaveInfoMap _saveInfos;
+	Common::List<int> _saveInfoOrder;
+	void addSaveInfo(const SaveStateDescriptor &desc);
+	void clearSaveInfos();
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
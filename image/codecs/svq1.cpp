@@ -527,88 +527,113 @@ void SVQ1Decoder::svq1SkipBlock(byte *current, byte *previous, int pitch, int x,
 	}
 }
 
-void SVQ1Decoder::putPixels8C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int i = 0; i < h; i++) {
-		*((uint32 *)block) = READ_UINT32(pixels);
-		*((uint32 *)(block + 4)) = READ_UINT32(pixels + 4);
-		pixels += lineSize;
-		block += lineSize;
-	}
-}
+// The half-pel motion compensation works on whole rows of four byte wide
+// columns. Each row of the source is loaded once and kept around for the next
+// output row, and the averaging of four pixels at a time is done in plain
+// 32-bit registers, which the compiler can keep in vector registers.
 
 static inline uint32 rndAvg32(uint32 a, uint32 b) {
 	return (a | b) - (((a ^ b) & ~0x01010101) >> 1);
 }
 
-void SVQ1Decoder::putPixels8L2(byte *dst, const byte *src1, const byte *src2,
-		int dstStride, int srcStride1, int srcStride2, int h) {
+template<int kWords>
+static inline void putPixelsRows(byte *block, const byte *pixels, int lineSize, int h) {
 	for (int i = 0; i < h; i++) {
-		uint32 a = READ_UINT32(&src1[srcStride1 * i]);
-		uint32 b = READ_UINT32(&src2[srcStride2 * i]);
-		*((uint32 *)&dst[dstStride * i]) = rndAvg32(a, b);
-		a = READ_UINT32(&src1[srcStride1 * i + 4]);
-		b = READ_UINT32(&src2[srcStride2 * i + 4]);
-		*((uint32 *)&dst[dstStride * i + 4]) = rndAvg32(a, b);
+		memcpy(block, pixels, kWords * 4);
+		pixels += lineSize;
+		block += lineSize;
 	}
 }
 
-void SVQ1Decoder::putPixels8X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + 1, lineSize, lineSize, lineSize, h);
+template<int kWords>
+static inline void putPixelsX2Rows(byte *block, const byte *pixels, int lineSize, int h) {
+	for (int i = 0; i < h; i++) {
+		for (int x = 0; x < kWords; x++)
+			*((uint32 *)(block + x * 4)) = rndAvg32(READ_UINT32(pixels + x * 4), READ_UINT32(pixels + x * 4 + 1));
+
+		pixels += lineSize;
+		block += lineSize;
+	}
 }
 
-void SVQ1Decoder::putPixels8Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + lineSize, lineSize, lineSize, lineSize, h);
+template<int kWords>
+static inline void putPixelsY2Rows(byte *block, const byte *pixels, int lineSize, int h) {
+	uint32 above[kWords];
+	for (int x = 0; x < kWords; x++)
+		above[x] = READ_UINT32(pixels + x * 4);
+
+	for (int i = 0; i < h; i++) {
+		pixels += lineSize;
+
+		for (int x = 0; x < kWords; x++) {
+			uint32 below = READ_UINT32(pixels + x * 4);
+			*((uint32 *)(block + x * 4)) = rndAvg32(above[x], below);
+			above[x] = below;
+		}
+
+		block += lineSize;
+	}
 }
 
-void SVQ1Decoder::putPixels8XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int j = 0; j < 2; j++) {
-		uint32 a = READ_UINT32(pixels);
-		uint32 b = READ_UINT32(pixels + 1);
-		uint32 l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-		uint32 h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+template<int kWords>
+static inline void putPixelsXY2Rows(byte *block, const byte *pixels, int lineSize, int h) {
+	// The sum of four pixels is split into the low two bits and the rest of
+	// each byte, so that it cannot carry into the neighbouring byte.
+	uint32 lowAbove[kWords], highAbove[kWords];
+	for (int x = 0; x < kWords; x++) {
+		uint32 a = READ_UINT32(pixels + x * 4);
+		uint32 b = READ_UINT32(pixels + x * 4 + 1);
+		lowAbove[x] = (a & 0x03030303UL) + (b & 0x03030303UL);
+		highAbove[x] = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+	}
 
+	for (int i = 0; i < h; i++) {
 		pixels += lineSize;
 
-		for (int i = 0; i < h; i += 2) {
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			uint32 l1 = (a & 0x03030303UL) + (b & 0x03030303UL);
-			uint32 h1 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-			h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
+		for (int x = 0; x < kWords; x++) {
+			uint32 a = READ_UINT32(pixels + x * 4);
+			uint32 b = READ_UINT32(pixels + x * 4 + 1);
+			uint32 low = (a & 0x03030303UL) + (b & 0x03030303UL);
+			uint32 high = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+			*((uint32 *)(block + x * 4)) = highAbove[x] + high + (((lowAbove[x] + low + 0x02020202UL) >> 2) & 0x0F0F0F0FUL);
+			lowAbove[x] = low;
+			highAbove[x] = high;
 		}
 
-		pixels += 4 - lineSize * (h + 1);
-		block += 4 - lineSize * h;
+		block += lineSize;
 	}
 }
 
+void SVQ1Decoder::putPixels8C(byte *block, const byte *pixels, int lineSize, int h) {
+	putPixelsRows<2>(block, pixels, lineSize, h);
+}
+
+void SVQ1Decoder::putPixels8X2C(byte *block, const byte *pixels, int lineSize, int h) {
+	putPixelsX2Rows<2>(block, pixels, lineSize, h);
+}
+
+void SVQ1Decoder::putPixels8Y2C(byte *block, const byte *pixels, int lineSize, int h) {
+	putPixelsY2Rows<2>(block, pixels, lineSize, h);
+}
+
+void SVQ1Decoder::putPixels8XY2C(byte *block, const byte *pixels, int lineSize, int h) {
+	putPixelsXY2Rows<2>(block, pixels, lineSize, h);
+}
+
 void SVQ1Decoder::putPixels16C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8C(block, pixels, lineSize, h);
-	putPixels8C(block + 8, pixels + 8, lineSize, h);
+	putPixelsRows<4>(block, pixels, lineSize, h);
 }
 
 void SVQ1Decoder::putPixels16X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8X2C(block, pixels, lineSize, h);
-	putPixels8X2C(block + 8, pixels + 8, lineSize, h);
+	putPixelsX2Rows<4>(block, pixels, lineSize, h);
 }
 
 void SVQ1Decoder::putPixels16Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8Y2C(block, pixels, lineSize, h);
-	putPixels8Y2C(block + 8, pixels + 8, lineSize, h);
+	putPixelsY2Rows<4>(block, pixels, lineSize, h);
 }
 
 void SVQ1Decoder::putPixels16XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8XY2C(block, pixels, lineSize, h);
-	putPixels8XY2C(block + 8, pixels + 8, lineSize, h);
+	putPixelsXY2Rows<4>(block, pixels, lineSize, h);
 }
 
 bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream *ss, byte *current, byte *previous, int pitch,
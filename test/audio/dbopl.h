@@ -0,0 +1,114 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/opl/dbopl.h"
+
+#ifndef DISABLE_DOSBOX_OPL
+
+// The expected checksums were recorded before the DBOPL speed-ups, so any
+// optimisation that changes the generated output will show up here.
+class DBOPLTestSuite : public CxxTest::TestSuite
+{
+private:
+	typedef OPL::DOSBox::DBOPL::Chip Chip;
+
+	static void setupInstruments(Chip &chip, bool opl3) {
+		static const int opOffsets[9] = { 0, 1, 2, 8, 9, 10, 16, 17, 18 };
+
+		if (opl3) {
+			chip.WriteReg(0x105, 0x01);
+			chip.WriteReg(0x104, 0x03);
+		}
+		chip.WriteReg(0x01, 0x20);
+
+		for (int ch = 0; ch < 9; ++ch) {
+			const int op = opOffsets[ch];
+			chip.WriteReg(0x20 + op, 0x21 + (ch & 3));
+			chip.WriteReg(0x23 + op, (ch & 1) ? 0xE1 : 0x21);
+			chip.WriteReg(0x40 + op, 0x10 + ch);
+			chip.WriteReg(0x43 + op, ch * 3);
+			chip.WriteReg(0x60 + op, 0xF2 - ch);
+			chip.WriteReg(0x63 + op, 0xA4 + ch);
+			chip.WriteReg(0x80 + op, 0x53 + ch * 4);
+			chip.WriteReg(0x83 + op, 0x24 + ch);
+			chip.WriteReg(0xE0 + op, ch & 3);
+			chip.WriteReg(0xE3 + op, (ch >> 1) & 3);
+			chip.WriteReg(0xC0 + ch, 0x30 | ((ch * 3) & 0x0E) | (ch & 1));
+
+			if (opl3) {
+				chip.WriteReg(0x120 + op, 0x22);
+				chip.WriteReg(0x123 + op, 0x21);
+				chip.WriteReg(0x140 + op, 0x08);
+				chip.WriteReg(0x143 + op, 0x04);
+				chip.WriteReg(0x160 + op, 0xF3);
+				chip.WriteReg(0x163 + op, 0xF4);
+				chip.WriteReg(0x180 + op, 0x34);
+				chip.WriteReg(0x183 + op, 0x25);
+				chip.WriteReg(0x1C0 + ch, 0x31 | (ch & 1));
+			}
+		}
+	}
+
+	static void playNotes(Chip &chip, int step, bool opl3, bool percussion) {
+		for (int ch = 0; ch < 9; ++ch) {
+			const int freq = 0x157 + (step * 7 + ch * 31) % 300;
+			const bool keyOn = ((step + ch) % 5) != 0;
+			chip.WriteReg(0xA0 + ch, freq & 0xFF);
+			chip.WriteReg(0xB0 + ch, (keyOn ? 0x20 : 0) | ((ch % 6 + 2) << 2) | (freq >> 8));
+
+			if (opl3) {
+				chip.WriteReg(0x1A0 + ch, freq & 0xFF);
+				chip.WriteReg(0x1B0 + ch, (((step + ch) % 3) ? 0x20 : 0) | (3 << 2) | (freq >> 8));
+			}
+		}
+
+		// Deep tremolo and vibrato, plus the rhythm mode instruments
+		chip.WriteReg(0xBD, 0xC0 | (percussion ? 0x20 | (step & 0x1F) : 0));
+	}
+
+	static uint32 render(bool opl3, bool percussion) {
+		OPL::DOSBox::DBOPL::InitTables();
+
+		Chip chip;
+		chip.Setup(49716);
+		setupInstruments(chip, opl3);
+
+		const int blockSize = 512;
+		const int channels = opl3 ? 2 : 1;
+		int32 buffer[blockSize * 2];
+		uint32 checksum = 0;
+
+		for (int block = 0; block < 200; ++block) {
+			if (!(block % 10))
+				playNotes(chip, block / 10, opl3, percussion);
+
+			if (opl3)
+				chip.GenerateBlock3(blockSize, buffer);
+			else
+				chip.GenerateBlock2(blockSize, buffer);
+
+			for (int i = 0; i < blockSize * channels; ++i)
+				checksum = checksum * 31 + (uint32)buffer[i];
+		}
+
+		return checksum;
+	}
+
+public:
+	void test_opl2_output() {
+		TS_ASSERT_EQUALS(render(false, false), 67098412u);
+	}
+
+	void test_opl3_output() {
+		TS_ASSERT_EQUALS(render(true, false), 456970528u);
+	}
+
+	void test_opl2_percussion_output() {
+		TS_ASSERT_EQUALS(render(false, true), 4241836750u);
+	}
+
+	void test_opl3_percussion_output() {
+		TS_ASSERT_EQUALS(render(true, true), 3488487776u);
+	}
+};
+
+#endif
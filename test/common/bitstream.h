@@ -149,4 +149,52 @@ class BitStreamTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(bs.peekBits(5), 12u);
 		TS_ASSERT(!bs.eos());
 	}
+
+	void test_get_bits_across_values() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x11, 0x22, 0x33, 0x44 };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream32BEMSB bs(ms);
+		TS_ASSERT_EQUALS(bs.getBits(4), 0x1u);
+		TS_ASSERT_EQUALS(bs.getBits(32), 0x23456789u);
+		TS_ASSERT_EQUALS(bs.pos(), 36u);
+		TS_ASSERT_EQUALS(bs.peekBits(32), 0xABCDEF01u);
+		TS_ASSERT_EQUALS(bs.pos(), 36u);
+		bs.skip(40);
+		TS_ASSERT_EQUALS(bs.pos(), 76u);
+		TS_ASSERT_EQUALS(bs.getBits(20), 0x23344u);
+		TS_ASSERT(bs.eos());
+	}
+
+	void test_get_bits_across_values_lsb() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0 };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream16LELSB bs(ms);
+		TS_ASSERT_EQUALS(bs.getBits(4), 0x2u);
+		TS_ASSERT_EQUALS(bs.getBits(32), 0xA7856341u);
+		TS_ASSERT_EQUALS(bs.pos(), 36u);
+		TS_ASSERT_EQUALS(bs.peekBits(28), 0xF0DEBC9u);
+		TS_ASSERT_EQUALS(bs.getBits(28), 0xF0DEBC9u);
+		TS_ASSERT(bs.eos());
+	}
+
+	void test_align() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream16BEMSB bs(ms);
+		bs.align();
+		TS_ASSERT_EQUALS(bs.pos(), 0u);
+		TS_ASSERT_EQUALS(bs.getBits(3), 0x0u);
+		bs.align();
+		TS_ASSERT_EQUALS(bs.pos(), 16u);
+		TS_ASSERT_EQUALS(bs.getBits(20), 0x56789u);
+		bs.align();
+		TS_ASSERT_EQUALS(bs.pos(), 48u);
+		TS_ASSERT(bs.eos());
+	}
 };
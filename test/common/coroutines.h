@@ -0,0 +1,83 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/coroutines.h"
+
+// A coroutine which sleeps twice, invoking a nested coroutine in between
+static void nestedCoroutine(CORO_PARAM, int *steps) {
+	CORO_BEGIN_CONTEXT;
+		int i;
+	CORO_END_CONTEXT(_ctx);
+
+	CORO_BEGIN_CODE(_ctx);
+
+	for (_ctx->i = 0; _ctx->i < 2; _ctx->i++) {
+		(*steps)++;
+		CORO_SLEEP(1);
+	}
+
+	CORO_END_CODE;
+}
+
+static void outerCoroutine(CORO_PARAM, int *steps) {
+	CORO_BEGIN_CONTEXT;
+		int value[10];
+	CORO_END_CONTEXT(_ctx);
+
+	CORO_BEGIN_CODE(_ctx);
+
+	(*steps)++;
+	CORO_SLEEP(1);
+	CORO_INVOKE_1(nestedCoroutine, steps);
+	(*steps)++;
+
+	CORO_END_CODE;
+}
+
+class CoroutineTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_resume() {
+		Common::CoroContext ctx = 0;
+		int steps = 0;
+
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT(ctx != 0);
+		TS_ASSERT_EQUALS(steps, 1);
+
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT(ctx != 0);
+		TS_ASSERT_EQUALS(steps, 2);
+
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT(ctx != 0);
+		TS_ASSERT_EQUALS(steps, 3);
+
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT(ctx == 0);
+		TS_ASSERT_EQUALS(steps, 4);
+	}
+
+	void test_context_reuse() {
+		Common::CoroContext ctx = 0;
+		int steps = 0;
+
+		outerCoroutine(ctx, &steps);
+		outerCoroutine(ctx, &steps);
+		Common::CoroContext outer = ctx;
+		Common::CoroContext nested = ctx->_subctx;
+		TS_ASSERT(nested != 0);
+
+		// Finishing the coroutine puts both contexts in the free lists
+		while (ctx)
+			outerCoroutine(ctx, &steps);
+
+		// and running it again takes them from there
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT_EQUALS(ctx, outer);
+		outerCoroutine(ctx, &steps);
+		TS_ASSERT_EQUALS(ctx->_subctx, nested);
+
+		while (ctx)
+			outerCoroutine(ctx, &steps);
+	}
+};
@@ -0,0 +1,142 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/fft.h"
+#include "common/rdft.h"
+#include "common/dct.h"
+#include "common/str.h"
+
+// Compares the transforms against a straightforward O(n^2) evaluation, so
+// that optimised kernels are checked against the definition rather than
+// against themselves.
+class FFTTestSuite : public CxxTest::TestSuite
+{
+private:
+	static void fillInput(float *data, int n) {
+		for (int i = 0; i < n; i++)
+			data[i] = (float)(sin(i * 0.37) + 0.25 * cos(i * 1.3));
+	}
+
+	// The rounding errors grow with the size of the transform
+	static double tolerance(int n) {
+		return 1e-5 * n;
+	}
+
+	static bool checkFFT(int bits) {
+		const int n = 1 << bits;
+		float *data = new float[2 * n];
+		float *input = new float[2 * n];
+		fillInput(input, 2 * n);
+		memcpy(data, input, 2 * n * sizeof(float));
+
+		Common::FFT fft(bits, 0);
+		fft.permute((Common::Complex *)data);
+		fft.calc((Common::Complex *)data);
+
+		bool ok = true;
+		for (int k = 0; k < n; k++) {
+			double re = 0.0, im = 0.0;
+			for (int j = 0; j < n; j++) {
+				const double a = -2.0 * M_PI * j * k / n;
+				re += input[2 * j] * cos(a) - input[2 * j + 1] * sin(a);
+				im += input[2 * j] * sin(a) + input[2 * j + 1] * cos(a);
+			}
+
+			if (fabs(data[2 * k] - re) > tolerance(n) || fabs(data[2 * k + 1] - im) > tolerance(n))
+				ok = false;
+		}
+
+		delete[] input;
+		delete[] data;
+		return ok;
+	}
+
+	static bool checkRDFT(int bits) {
+		const int n = 1 << bits;
+		float *data = new float[n];
+		float *input = new float[n];
+		fillInput(input, n);
+		memcpy(data, input, n * sizeof(float));
+
+		Common::RDFT rdft(bits, Common::RDFT::DFT_R2C);
+		rdft.calc(data);
+
+		bool ok = true;
+		for (int k = 0; k < n / 2; k++) {
+			double re = 0.0, im = 0.0;
+			for (int j = 0; j < n; j++) {
+				const double a = -2.0 * M_PI * j * k / n;
+				re += input[j] * cos(a);
+				im += input[j] * sin(a);
+			}
+
+			// The real value at n/2 is packed into the first coefficient
+			if (k == 0)
+				for (int j = 0; j < n; j++)
+					im += (j & 1) ? -input[j] : input[j];
+
+			if (fabs(data[2 * k] - re) > tolerance(n) || fabs(data[2 * k + 1] - im) > tolerance(n))
+				ok = false;
+		}
+
+		// The inverse transform should give back the input, scaled by n/2
+		Common::RDFT irdft(bits, Common::RDFT::IDFT_C2R);
+		irdft.calc(data);
+
+		for (int i = 0; i < n; i++)
+			if (fabs(data[i] / (n / 2) - input[i]) > tolerance(n))
+				ok = false;
+
+		delete[] input;
+		delete[] data;
+		return ok;
+	}
+
+	static bool checkDCT(int bits) {
+		const int n = 1 << bits;
+		float *data = new float[n];
+		float *input = new float[n];
+		fillInput(input, n);
+		memcpy(data, input, n * sizeof(float));
+
+		Common::DCT dct(bits, Common::DCT::DCT_II);
+		dct.calc(data);
+
+		bool ok = true;
+		for (int k = 0; k < n; k++) {
+			double sum = 0.0;
+			for (int j = 0; j < n; j++)
+				sum += input[j] * cos(M_PI / n * (j + 0.5) * k);
+
+			if (fabs(data[k] - sum) > tolerance(n))
+				ok = false;
+		}
+
+		// DCT-III is the inverse of DCT-II
+		Common::DCT idct(bits, Common::DCT::DCT_III);
+		idct.calc(data);
+
+		for (int i = 0; i < n; i++)
+			if (fabs(data[i] - input[i]) > tolerance(n))
+				ok = false;
+
+		delete[] input;
+		delete[] data;
+		return ok;
+	}
+
+public:
+	void test_fft() {
+		for (int bits = 2; bits <= 10; bits++)
+			TSM_ASSERT(Common::String::format("FFT size %d", 1 << bits).c_str(), checkFFT(bits));
+	}
+
+	void test_rdft() {
+		for (int bits = 4; bits <= 11; bits++)
+			TSM_ASSERT(Common::String::format("RDFT size %d", 1 << bits).c_str(), checkRDFT(bits));
+	}
+
+	void test_dct() {
+		for (int bits = 4; bits <= 11; bits++)
+			TSM_ASSERT(Common::String::format("DCT size %d", 1 << bits).c_str(), checkDCT(bits));
+	}
+};
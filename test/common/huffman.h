@@ -10,6 +10,80 @@
 * TODO: It could be improved by generating one at runtime.
 */
 class HuffmanTestSuite : public CxxTest::TestSuite {
+	private:
+	/**
+	 * Append a code to a bit buffer, in the order the bit stream will
+	 * hand it out again.
+	 */
+	static void writeCode(byte *buffer, uint32 &pos, uint32 code, uint8 length, bool msb) {
+		for (uint8 i = 0; i < length; i++, pos++) {
+			const uint32 bit = msb ? (code >> (length - 1 - i)) & 1 : (code >> i) & 1;
+			if (msb)
+				buffer[pos / 8] |= bit << (7 - (pos % 8));
+			else
+				buffer[pos / 8] |= bit << (pos % 8);
+		}
+	}
+
+	/**
+	 * Decode symbols with codes both shorter and longer than the lookup
+	 * table, including some within the last few bits of the stream.
+	 */
+	static void testLongCodes(bool msb) {
+		/*
+		 * Encoding:
+		 * 0=0
+		 * 1=10
+		 * 2=110
+		 * ...
+		 * 10=11111111110
+		 * 11=11111111111
+		 */
+		const uint32 codeCount = 12;
+		uint32 codes[codeCount];
+		uint8 lengths[codeCount];
+		for (uint32 i = 0; i < codeCount - 1; i++) {
+			lengths[i] = i + 1;
+			codes[i] = ((1 << i) - 1) << 1;
+		}
+		lengths[codeCount - 1] = codeCount - 1;
+		codes[codeCount - 1] = (1 << (codeCount - 1)) - 1;
+
+		// LSB first streams build the codes starting from their lowest bit
+		if (!msb) {
+			for (uint32 i = 0; i < codeCount; i++) {
+				uint32 reversed = 0;
+				for (uint8 j = 0; j < lengths[i]; j++)
+					reversed |= ((codes[i] >> j) & 1) << (lengths[i] - 1 - j);
+				codes[i] = reversed;
+			}
+		}
+
+		Common::Huffman h(0, codeCount, codes, lengths, 0);
+
+		const uint32 expected[] = {0, 11, 10, 5, 1, 11, 8, 0, 9, 2, 0, 3, 1};
+		const uint32 symbolCount = ARRAYSIZE(expected);
+
+		byte input[16];
+		memset(input, 0, sizeof(input));
+		uint32 pos = 0;
+		for (uint32 i = 0; i < symbolCount; i++)
+			writeCode(input, pos, codes[expected[i]], lengths[expected[i]], msb);
+
+		Common::MemoryReadStream ms(input, (pos + 7) / 8);
+		Common::BitStream *bs;
+		if (msb)
+			bs = new Common::BitStream8MSB(ms);
+		else
+			bs = new Common::BitStream8LSB(ms);
+
+		for (uint32 i = 0; i < symbolCount; i++)
+			TS_ASSERT_EQUALS(h.getSymbol(*bs), expected[i]);
+
+		TS_ASSERT_EQUALS(bs->pos(), pos);
+		delete bs;
+	}
+
 	public:
 	void test_get_with_full_symbols() {
 
@@ -141,4 +215,12 @@ class HuffmanTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[5]);
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[6]);
 	}
+
+	void test_get_long_codes_msb() {
+		testLongCodes(true);
+	}
+
+	void test_get_long_codes_lsb() {
+		testLongCodes(false);
+	}
 };
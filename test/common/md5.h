@@ -47,4 +47,27 @@ class MD5TestSuite : public CxxTest::TestSuite {
 		}
 	}
 
+	void test_incremental() {
+		for (int i = 0; i < 7; i++) {
+			const uint32 len = strlen(md5_test_string[i]);
+
+			// Feed the data in pieces of varying size
+			Common::MD5 md5;
+			for (uint32 pos = 0, step = 1; pos < len; pos += step, step = step * 2 + 1)
+				md5.update(md5_test_string[i] + pos, MIN(step, len - pos));
+
+			TS_ASSERT_EQUALS(md5.finishAsString(), md5_test_digest[i]);
+
+			md5.reset();
+			md5.update(md5_test_string[i], len);
+			TS_ASSERT_EQUALS(md5.finishAsString(), md5_test_digest[i]);
+		}
+	}
+
+	void test_length() {
+		// Only the first three bytes of "abcdef" are used
+		Common::MemoryReadStream stream((const byte *)"abcdef", 6);
+		TS_ASSERT_EQUALS(Common::computeStreamMD5AsString(stream, 3), md5_test_digest[2]);
+	}
+
 };
@@ -32,12 +32,15 @@
 
 #include "audio/audiostream.h"
 
+#include "common/algorithm.h"
 #include "common/debug.h"
 #include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/util.h"
 
+#include "graphics/surface.h"
+
 // Video codecs
 #include "image/codecs/codec.h"
 
@@ -283,6 +286,15 @@ Audio::SeekableAudioStream *QuickTimeDecoder::AudioTrackHandler::getSeekableAudi
 }
 
 QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder, Common::QuickTimeParser::Track *parent) : _decoder(decoder), _parent(parent) {
+	// The sync sample table should already be in order, but nothing
+	// guarantees it, and findKeyFrame() relies on it.
+	_keyFrames.resize(_parent->keyframeCount);
+	for (uint32 i = 0; i < _parent->keyframeCount; i++)
+		_keyFrames[i] = _parent->keyframes[i];
+	Common::sort(_keyFrames.begin(), _keyFrames.end());
+
+	_frameCacheSize = 0;
+
 	_curEdit = 0;
 	enterNewEditList(false);
 
@@ -300,6 +312,8 @@ QuickTimeDecoder::VideoTrackHandler::~VideoTrackHandler() {
 		_scaledSurface->free();
 		delete _scaledSurface;
 	}
+
+	clearFrameCache();
 }
 
 bool QuickTimeDecoder::VideoTrackHandler::endOfTrack() const {
@@ -405,6 +419,8 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::decodeNextFrame()
 	if (endOfTrack())
 		return 0;
 
+	const Graphics::Surface *frame = 0;
+
 	if (_reversed) {
 		// Subtract one to place us on the frame before the current displayed frame.
 		_curFrame--;
@@ -414,15 +430,22 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::decodeNextFrame()
 		if (_curFrame < 0)
 			return 0;
 
-		// Decode from the last key frame to the frame before the one we need.
-		// TODO: Probably would be wise to do some caching
-		int targetFrame = _curFrame;
-		_curFrame = findKeyFrame(targetFrame) - 1;
-		while (_curFrame != targetFrame - 1)
-			bufferNextFrame();
-	}
+		frame = getCachedFrame(_curFrame);
 
-	const Graphics::Surface *frame = bufferNextFrame();
+		if (!frame) {
+			// Decode from the last key frame to the frame before the one we need.
+			// All of these end up in the frame cache, so the following frames
+			// can be taken from there.
+			int targetFrame = _curFrame;
+			_curFrame = findKeyFrame(targetFrame) - 1;
+			while (_curFrame != targetFrame - 1)
+				bufferNextFrame();
+
+			frame = bufferNextFrame();
+		}
+	} else {
+		frame = bufferNextFrame();
+	}
 
 	if (_reversed) {
 		if (_holdNextFrameStartTime) {
@@ -601,14 +624,81 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
+	// Binary search for the last key frame not after the requested one
+	uint32 first = 0, last = _keyFrames.size();
+	while (first < last) {
+		uint32 mid = (first + last) / 2;
+		if (_keyFrames[mid] <= frame)
+			first = mid + 1;
+		else
+			last = mid;
+	}
+
+	if (first > 0)
+		return _keyFrames[first - 1];
 
 	// If none found, we'll assume the requested frame is a key frame
 	return frame;
 }
 
+const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::getCachedFrame(int32 frame) {
+	for (Common::List<CachedFrame>::iterator it = _frameCache.begin(); it != _frameCache.end(); ++it) {
+		if (it->frame != frame)
+			continue;
+
+		// Move it to the front, so that it is the last one to be dropped
+		CachedFrame entry = *it;
+		_frameCache.erase(it);
+		_frameCache.push_front(entry);
+
+		if (entry.palette != _curPalette) {
+			_curPalette = entry.palette;
+			_dirtyPalette = true;
+		}
+
+		return entry.surface;
+	}
+
+	return 0;
+}
+
+void QuickTimeDecoder::VideoTrackHandler::cacheFrame(const Graphics::Surface *frame, const byte *palette) {
+	uint32 size = frame->w * frame->h * frame->format.bytesPerPixel;
+	if (size > kMaxFrameCacheSize)
+		return;
+
+	for (Common::List<CachedFrame>::const_iterator it = _frameCache.begin(); it != _frameCache.end(); ++it)
+		if (it->frame == _curFrame)
+			return;
+
+	// Make room by dropping the least recently used frames
+	while (_frameCacheSize + size > kMaxFrameCacheSize) {
+		CachedFrame &oldest = _frameCache.back();
+		_frameCacheSize -= oldest.surface->w * oldest.surface->h * oldest.surface->format.bytesPerPixel;
+		oldest.surface->free();
+		delete oldest.surface;
+		_frameCache.pop_back();
+	}
+
+	CachedFrame entry;
+	entry.frame = _curFrame;
+	entry.surface = new Graphics::Surface();
+	entry.surface->copyFrom(*frame);
+	entry.palette = palette;
+	_frameCache.push_front(entry);
+	_frameCacheSize += size;
+}
+
+void QuickTimeDecoder::VideoTrackHandler::clearFrameCache() {
+	for (Common::List<CachedFrame>::iterator it = _frameCache.begin(); it != _frameCache.end(); ++it) {
+		it->surface->free();
+		delete it->surface;
+	}
+
+	_frameCache.clear();
+	_frameCacheSize = 0;
+}
+
 void QuickTimeDecoder::VideoTrackHandler::enterNewEditList(bool bufferFrames) {
 	// Bypass all empty edit lists first
 	while (!atLastEdit() && _parent->editList[_curEdit].mediaTime == -1)
@@ -704,6 +794,11 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::bufferNextFrame()
 		}
 	}
 
+	// Only frames of codecs without their own palette can be cached, as
+	// those palettes change along with the codec state.
+	if (frame && _reversed && !entry->_videoCodec->containsPalette())
+		cacheFrame(frame, entry->_palette);
+
 	return frame;
 }
 
@@ -32,6 +32,8 @@
 #define VIDEO_QT_DECODER_H
 
 #include "audio/decoders/quicktime_intern.h"
+#include "common/array.h"
+#include "common/list.h"
 #include "common/scummsys.h"
 
 #include "video/video_decoder.h"
@@ -42,6 +44,7 @@ class Rational;
 
 namespace Graphics {
 struct PixelFormat;
+struct Surface;
 }
 
 namespace Image {
@@ -157,6 +160,29 @@ private:
 		mutable bool _dirtyPalette;
 		bool _reversed;
 
+		// Sorted copy of the track's sync sample table
+		Common::Array<uint32> _keyFrames;
+
+		// Frames decoded while playing in reverse, most recently used first.
+		// Reverse playback decodes the GOP leading up to a frame once and
+		// then serves the frames before it from here.
+		struct CachedFrame {
+			int32 frame;
+			Graphics::Surface *surface;
+			const byte *palette;
+		};
+
+		enum {
+			kMaxFrameCacheSize = 8 * 1024 * 1024 ///< Maximum size of the cached frames in bytes
+		};
+
+		Common::List<CachedFrame> _frameCache;
+		uint32 _frameCacheSize;
+
+		const Graphics::Surface *getCachedFrame(int32 frame);
+		void cacheFrame(const Graphics::Surface *frame, const byte *palette);
+		void clearFrameCache();
+
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
 		uint32 getFrameDuration();
 		uint32 findKeyFrame(uint32 frame) const;
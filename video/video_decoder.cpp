@@ -25,11 +25,13 @@
 #include "audio/audiostream.h"
 #include "audio/mixer.h" // for kMaxChannelVolume
 
+#include "common/debug.h"
 #include "common/rational.h"
 #include "common/file.h"
 #include "common/system.h"
 
 #include "graphics/palette.h"
+#include "graphics/surface.h"
 
 namespace Video {
 
@@ -47,6 +49,8 @@ VideoDecoder::VideoDecoder() {
 	_endTimeSet = false;
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
+	_frameBuffer = 0;
+	_frameBufferAllocations = 0;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -55,6 +59,10 @@ VideoDecoder::VideoDecoder() {
 		_defaultHighColorFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
 }
 
+VideoDecoder::~VideoDecoder() {
+	freeFrameBuffer();
+}
+
 void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
@@ -77,6 +85,8 @@ void VideoDecoder::close() {
 	_endTimeSet = false;
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
+
+	freeFrameBuffer();
 }
 
 bool VideoDecoder::loadFile(const Common::String &filename) {
@@ -192,6 +202,41 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	return frame;
 }
 
+bool VideoDecoder::decodeNextFrameInto(Graphics::Surface &dst) {
+	const Graphics::Surface *frame = decodeNextFrame();
+	if (!frame)
+		return false;
+
+	frame->convertInto(dst, _palette);
+	return true;
+}
+
+const Graphics::Surface *VideoDecoder::decodeNextConvertedFrame(const Graphics::PixelFormat &format) {
+	const Graphics::Surface *frame = decodeNextFrame();
+	if (!frame || frame->format == format)
+		return frame;
+
+	if (!_frameBuffer || _frameBuffer->w != frame->w || _frameBuffer->h != frame->h || _frameBuffer->format != format) {
+		freeFrameBuffer();
+		_frameBuffer = new Graphics::Surface();
+		_frameBuffer->create(frame->w, frame->h, format);
+		_frameBufferAllocations++;
+		debug(2, "VideoDecoder: Allocated %dx%d frame buffer (%d allocations so far)", frame->w, frame->h, _frameBufferAllocations);
+	}
+
+	frame->convertInto(*_frameBuffer, _palette);
+	return _frameBuffer;
+}
+
+void VideoDecoder::freeFrameBuffer() {
+	if (!_frameBuffer)
+		return;
+
+	_frameBuffer->free();
+	delete _frameBuffer;
+	_frameBuffer = 0;
+}
+
 bool VideoDecoder::setReverse(bool reverse) {
 	// Can only reverse video-only videos
 	if (reverse && hasAudio())
@@ -52,7 +52,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -355,6 +355,34 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Decode the next frame straight into a surface owned by the caller.
+	 *
+	 * The frame is converted to the pixel format of the destination, which
+	 * may be a sub-area of a bigger surface, e.g. the area of the video on
+	 * an engine's back buffer. Only the part of the frame that fits is
+	 * written. Nothing is allocated, and no intermediate copy is made.
+	 *
+	 * @param dst the surface to write the frame to
+	 * @return true if a frame was decoded, false otherwise
+	 */
+	bool decodeNextFrameInto(Graphics::Surface &dst);
+
+	/**
+	 * Decode the next frame and return it in the given pixel format.
+	 *
+	 * Frames which already are in that format are returned as is. All others
+	 * are converted into a frame buffer owned by the VideoDecoder, which is
+	 * only reallocated when the size or format of the output changes. The
+	 * number of those allocations is shown in the debug output.
+	 *
+	 * @param format the pixel format the frame should be in
+	 * @return a surface containing the decoded frame, or 0
+	 * @note Ownership of the returned surface stays with the VideoDecoder,
+	 *       and it is only valid until the next frame is decoded.
+	 */
+	const Graphics::Surface *decodeNextConvertedFrame(const Graphics::PixelFormat &format);
+
 	/**
 	 * Set the default high color format for videos that convert from YUV.
 	 *
@@ -904,6 +932,11 @@ private:
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 
+	// Reused buffer for frames converted by decodeNextConvertedFrame()
+	Graphics::Surface *_frameBuffer;
+	uint32 _frameBufferAllocations;
+	void freeFrameBuffer();
+
 	// Internal helper functions
 	void stopAudio();
 	void startAudio();